@@ -64,9 +64,9 @@ auto json_for_monthly_summary(const std::map<int, MonthlySummary>& monthly_summa
   for (const auto& [month, value] : monthly_summary) {
     Json entry;
     entry["month"] = month;
-    entry["income"] = value.income;
-    entry["expense"] = value.expense;
-    entry["balance"] = value.income + value.expense;
+    entry["income"] = value.income.ToDouble();
+    entry["expense"] = value.expense.ToDouble();
+    entry["balance"] = (value.income + value.expense).ToDouble();
     summary.push_back(std::move(entry));
   }
   return summary;
@@ -157,9 +157,11 @@ auto query_year(const std::string& db_path, const std::string& iso_year)
   data["query_value"] = iso_year;
   data["year"] = query_result->execution.year;
   data["matched_bills"] = query_result->matched_bills;
-  data["total_income"] = query_result->execution.yearly_data.total_income;
-  data["total_expense"] = query_result->execution.yearly_data.total_expense;
-  data["balance"] = query_result->execution.yearly_data.balance;
+  data["total_income"] =
+      query_result->execution.yearly_data.total_income.ToDouble();
+  data["total_expense"] =
+      query_result->execution.yearly_data.total_expense.ToDouble();
+  data["balance"] = query_result->execution.yearly_data.balance.ToDouble();
   data["monthly_summary"] =
       json_for_monthly_summary(query_result->execution.yearly_data.monthly_summary);
   attach_rendered_report_payload(data, *query_result);
@@ -203,9 +205,11 @@ auto query_month(const std::string& db_path, const std::string& iso_month)
   data["month"] = *query_result->execution.month;
   data["matched_bills"] = query_result->matched_bills;
   data["transaction_count"] = query_result->transaction_count;
-  data["total_income"] = query_result->execution.monthly_data.total_income;
-  data["total_expense"] = query_result->execution.monthly_data.total_expense;
-  data["balance"] = query_result->execution.monthly_data.balance;
+  data["total_income"] =
+      query_result->execution.monthly_data.total_income.ToDouble();
+  data["total_expense"] =
+      query_result->execution.monthly_data.total_expense.ToDouble();
+  data["balance"] = query_result->execution.monthly_data.balance.ToDouble();
   data["remark"] = query_result->execution.monthly_data.remark;
   attach_rendered_report_payload(data, *query_result);
   return bills::android::jni::MakeResponse(
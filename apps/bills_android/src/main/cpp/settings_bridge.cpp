@@ -77,6 +77,19 @@ auto validate_config_texts(const std::string& validator_text,
       result->message, std::move(data));
 }
 
+auto set_database_profile(const std::string& profile_name) -> std::string {
+  const auto selected = bills::io::SelectDatabaseProfile(profile_name);
+  if (!selected) {
+    return bills::android::jni::MakeResponse(
+        false, "param.invalid_argument", FormatError(selected.error()));
+  }
+
+  Json data;
+  data["database_profile"] = profile_name;
+  return bills::android::jni::MakeResponse(
+      true, "ok", "Database profile updated successfully.", std::move(data));
+}
+
 }  // namespace
 
 extern "C" JNIEXPORT jstring JNICALL
@@ -98,3 +111,11 @@ Java_com_billstracer_android_data_nativebridge_SettingsNativeBindings_validateCo
                                                                    export_formats_text));
   });
 }
+
+extern "C" JNIEXPORT jstring JNICALL
+Java_com_billstracer_android_data_nativebridge_SettingsNativeBindings_setDatabaseProfileNative(
+    JNIEnv* env, jclass, jstring profile_name) {
+  return bills::android::jni::SafeCall(env, [&]() -> std::string {
+    return set_database_profile(bills::android::jni::FromJString(env, profile_name));
+  });
+}
@@ -12,6 +12,7 @@ import com.billstracer.android.app.navigation.AppSessionViewModelFactory
 import com.billstracer.android.app.navigation.BillsAndroidApp
 import com.billstracer.android.app.navigation.WorkspaceDataChangeBus
 import com.billstracer.android.app.theme.BillsAndroidTheme
+import com.billstracer.android.data.prefs.DatabaseProfilePreferenceStore
 import com.billstracer.android.data.prefs.ThemePreferenceStore
 import com.billstracer.android.data.runtime.AndroidWorkspaceRuntime
 import com.billstracer.android.data.services.DefaultBackupService
@@ -34,10 +35,14 @@ class MainActivity : ComponentActivity() {
     private val workspaceDataChangeBus by lazy { WorkspaceDataChangeBus() }
     private val workspaceRuntime by lazy { AndroidWorkspaceRuntime(applicationContext) }
     private val themePreferenceStore by lazy { ThemePreferenceStore(applicationContext) }
+    private val databaseProfilePreferenceStore by lazy {
+        DatabaseProfilePreferenceStore(applicationContext)
+    }
     private val settingsDataSource by lazy {
         SettingsDataSource(
             runtime = workspaceRuntime,
             themePreferenceStore = themePreferenceStore,
+            databaseProfilePreferenceStore = databaseProfilePreferenceStore,
         )
     }
     private val workspaceService by lazy {
@@ -194,6 +194,7 @@ internal fun BillsAndroidApp(
                         onSelectThemeColor = settingsViewModel::updateThemeColorDraft,
                         onApplyTheme = settingsViewModel::applyThemeDraft,
                         onResetThemeDraft = settingsViewModel::resetThemeDraft,
+                        onSelectDatabaseProfile = settingsViewModel::applyDatabaseProfile,
                         modifier = contentModifier,
                     )
                 }
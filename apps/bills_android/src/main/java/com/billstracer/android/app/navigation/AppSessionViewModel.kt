@@ -64,6 +64,7 @@ class AppSessionViewModel(
                 val environment = workspaceService.initializeEnvironment()
                 val (coreVersion, androidVersion) = settingsService.loadVersionInfo()
                 val themePreferences = settingsService.loadThemePreferences()
+                settingsService.loadDatabaseProfile()
                 Triple(environment, coreVersion, androidVersion) to themePreferences
             }.onSuccess { (versions, themePreferences) ->
                 val (environment, coreVersion, androidVersion) = versions
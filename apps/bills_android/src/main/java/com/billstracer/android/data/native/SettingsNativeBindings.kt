@@ -12,4 +12,6 @@ internal object SettingsNativeBindings {
         modifierText: String,
         exportFormatsText: String,
     ): String
+
+    external fun setDatabaseProfileNative(profileName: String): String
 }
@@ -0,0 +1,38 @@
+package com.billstracer.android.data.prefs
+
+import android.content.Context
+import androidx.datastore.core.DataStore
+import androidx.datastore.preferences.core.Preferences
+import androidx.datastore.preferences.core.edit
+import androidx.datastore.preferences.core.stringPreferencesKey
+import androidx.datastore.preferences.preferencesDataStore
+import com.billstracer.android.model.DatabaseProfile
+import kotlinx.coroutines.flow.first
+
+private val Context.databaseProfileDataStore: DataStore<Preferences> by preferencesDataStore(
+    name = "bills_android_database_preferences",
+)
+
+internal class DatabaseProfilePreferenceStore(
+    context: Context,
+) {
+    private val dataStore = context.applicationContext.databaseProfileDataStore
+
+    suspend fun load(): DatabaseProfile {
+        val preferences = dataStore.data.first()
+        return preferences[databaseProfileKey]
+            ?.let { rawValue -> runCatching { enumValueOf<DatabaseProfile>(rawValue) }.getOrNull() }
+            ?: DatabaseProfile.DEFAULT
+    }
+
+    suspend fun save(profile: DatabaseProfile): DatabaseProfile {
+        dataStore.edit { preferences ->
+            preferences[databaseProfileKey] = profile.name
+        }
+        return profile
+    }
+
+    private companion object {
+        val databaseProfileKey = stringPreferencesKey("database_profile")
+    }
+}
@@ -8,6 +8,7 @@ import com.billstracer.android.data.nativebridge.string
 import com.billstracer.android.model.BundledConfigFile
 import com.billstracer.android.model.BundledNotices
 import com.billstracer.android.model.ConfigTextsValidationResult
+import com.billstracer.android.model.DatabaseProfile
 import com.billstracer.android.model.ThemePreferences
 import com.billstracer.android.model.VersionInfo
 import kotlinx.coroutines.Dispatchers
@@ -48,6 +49,25 @@ internal class DefaultSettingsService(
     override suspend fun updateThemePreferences(preferences: ThemePreferences): ThemePreferences =
         settingsDataSource.updateThemePreferences(preferences)
 
+    override suspend fun loadDatabaseProfile(): DatabaseProfile {
+        val profile = settingsDataSource.loadDatabaseProfile()
+        applyNativeDatabaseProfile(profile)
+        return profile
+    }
+
+    override suspend fun updateDatabaseProfile(profile: DatabaseProfile): DatabaseProfile {
+        applyNativeDatabaseProfile(profile)
+        return settingsDataSource.saveDatabaseProfile(profile)
+    }
+
+    private suspend fun applyNativeDatabaseProfile(profile: DatabaseProfile) =
+        withContext(Dispatchers.IO) {
+            val root = parseRoot(SettingsNativeBindings.setDatabaseProfileNative(profile.nativeName))
+            if (!root.boolean("ok")) {
+                error(root.string("message").ifBlank { "Failed to apply database profile." })
+            }
+        }
+
     override suspend fun loadBundledNotices(): BundledNotices =
         settingsDataSource.loadBundledNotices()
 
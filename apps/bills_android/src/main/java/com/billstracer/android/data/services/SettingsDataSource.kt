@@ -1,9 +1,11 @@
 package com.billstracer.android.data.services
 
+import com.billstracer.android.data.prefs.DatabaseProfilePreferenceStore
 import com.billstracer.android.data.prefs.ThemePreferenceStore
 import com.billstracer.android.data.runtime.AndroidWorkspaceRuntime
 import com.billstracer.android.model.BundledConfigFile
 import com.billstracer.android.model.BundledNotices
+import com.billstracer.android.model.DatabaseProfile
 import com.billstracer.android.model.ThemePreferences
 import kotlinx.coroutines.Dispatchers
 import kotlinx.coroutines.withContext
@@ -12,6 +14,7 @@ import java.io.File
 internal class SettingsDataSource(
     private val runtime: AndroidWorkspaceRuntime,
     private val themePreferenceStore: ThemePreferenceStore,
+    private val databaseProfilePreferenceStore: DatabaseProfilePreferenceStore,
 ) {
     private companion object {
         val bundledConfigOrder = listOf(
@@ -48,6 +51,11 @@ internal class SettingsDataSource(
     suspend fun updateThemePreferences(preferences: ThemePreferences): ThemePreferences =
         themePreferenceStore.save(preferences)
 
+    suspend fun loadDatabaseProfile(): DatabaseProfile = databaseProfilePreferenceStore.load()
+
+    suspend fun saveDatabaseProfile(profile: DatabaseProfile): DatabaseProfile =
+        databaseProfilePreferenceStore.save(profile)
+
     suspend fun loadBundledNotices(): BundledNotices = withContext(Dispatchers.IO) {
         val workspace = runtime.initializeWorkspace()
         BundledNotices(
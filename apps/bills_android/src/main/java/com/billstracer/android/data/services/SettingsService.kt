@@ -3,6 +3,7 @@ package com.billstracer.android.data.services
 import com.billstracer.android.model.BundledConfigFile
 import com.billstracer.android.model.BundledNotices
 import com.billstracer.android.model.ConfigTextsValidationResult
+import com.billstracer.android.model.DatabaseProfile
 import com.billstracer.android.model.ThemePreferences
 import com.billstracer.android.model.VersionInfo
 
@@ -21,6 +22,10 @@ interface SettingsService {
 
     suspend fun updateThemePreferences(preferences: ThemePreferences): ThemePreferences
 
+    suspend fun loadDatabaseProfile(): DatabaseProfile
+
+    suspend fun updateDatabaseProfile(profile: DatabaseProfile): DatabaseProfile
+
     suspend fun loadBundledNotices(): BundledNotices
 
     suspend fun loadVersionInfo(): Pair<VersionInfo, VersionInfo>
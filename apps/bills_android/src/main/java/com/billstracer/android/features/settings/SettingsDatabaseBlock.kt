@@ -0,0 +1,49 @@
+package com.billstracer.android.features.settings
+
+import androidx.compose.foundation.horizontalScroll
+import androidx.compose.foundation.layout.Arrangement
+import androidx.compose.foundation.layout.Row
+import androidx.compose.foundation.layout.fillMaxWidth
+import androidx.compose.foundation.rememberScrollState
+import androidx.compose.material3.MaterialTheme
+import androidx.compose.material3.Text
+import androidx.compose.runtime.Composable
+import androidx.compose.ui.Modifier
+import androidx.compose.ui.text.font.FontFamily
+import androidx.compose.ui.unit.dp
+import com.billstracer.android.model.DatabaseProfile
+import com.billstracer.android.platform.SectionGroupCard
+
+@Composable
+internal fun DatabaseSettingsBlock(
+    state: SettingsUiState,
+    onSelectDatabaseProfile: (DatabaseProfile) -> Unit,
+) {
+    SectionGroupCard(title = "SQLite Profile") {
+        Text(
+            text = "Applies to database connections opened after the change. The selection is persisted with DataStore and restored on launch.",
+            style = MaterialTheme.typography.bodySmall,
+            fontFamily = FontFamily.Monospace,
+        )
+        Row(
+            modifier = Modifier
+                .fillMaxWidth()
+                .horizontalScroll(rememberScrollState()),
+            horizontalArrangement = Arrangement.spacedBy(8.dp),
+        ) {
+            DatabaseProfile.entries.forEach { profile ->
+                ConfigModeChip(
+                    label = profile.displayName,
+                    selected = state.databaseProfile == profile,
+                    onClick = { onSelectDatabaseProfile(profile) },
+                    testTag = "settings_database_profile_${profile.nativeName}",
+                )
+            }
+        }
+        Text(
+            text = state.databaseProfile.description,
+            style = MaterialTheme.typography.bodySmall,
+            fontFamily = FontFamily.Monospace,
+        )
+    }
+}
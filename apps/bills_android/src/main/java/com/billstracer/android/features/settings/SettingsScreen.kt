@@ -11,6 +11,7 @@ import androidx.compose.runtime.saveable.rememberSaveable
 import androidx.compose.runtime.setValue
 import androidx.compose.ui.Modifier
 import androidx.compose.ui.unit.dp
+import com.billstracer.android.model.DatabaseProfile
 import com.billstracer.android.model.ThemeColor
 import com.billstracer.android.model.ThemeMode
 import com.billstracer.android.platform.PaneContent
@@ -21,6 +22,7 @@ private enum class SettingsSubview(
     TOML("TOML"),
     BACKUP("Backup"),
     THEME("Theme"),
+    DATABASE("Database"),
     ABOUT("About"),
 }
 
@@ -37,6 +39,7 @@ internal fun SettingsScreen(
     onSelectThemeColor: (ThemeColor) -> Unit,
     onApplyTheme: () -> Unit,
     onResetThemeDraft: () -> Unit,
+    onSelectDatabaseProfile: (DatabaseProfile) -> Unit,
     modifier: Modifier = Modifier,
 ) {
     var selectedSubview by rememberSaveable { mutableStateOf(SettingsSubview.TOML) }
@@ -56,6 +59,7 @@ internal fun SettingsScreen(
                         SettingsSubview.TOML -> "settings_toml_button"
                         SettingsSubview.BACKUP -> "settings_backup_button"
                         SettingsSubview.THEME -> "settings_theme_button"
+                        SettingsSubview.DATABASE -> "settings_database_button"
                         SettingsSubview.ABOUT -> "settings_about_button"
                     },
                 )
@@ -88,6 +92,12 @@ internal fun SettingsScreen(
                     onResetThemeDraft = onResetThemeDraft,
                 )
             }
+            SettingsSubview.DATABASE -> {
+                DatabaseSettingsBlock(
+                    state = state,
+                    onSelectDatabaseProfile = onSelectDatabaseProfile,
+                )
+            }
             SettingsSubview.ABOUT -> {
                 state.bundledNotices?.let { notices ->
                     AboutBlock(notices = notices)
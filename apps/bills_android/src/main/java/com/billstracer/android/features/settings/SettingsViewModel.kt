@@ -9,6 +9,7 @@ import com.billstracer.android.data.services.BackupService
 import com.billstracer.android.data.services.SettingsService
 import com.billstracer.android.model.BundledConfigFile
 import com.billstracer.android.model.BundledNotices
+import com.billstracer.android.model.DatabaseProfile
 import com.billstracer.android.model.ExportedBackupBundleResult
 import com.billstracer.android.model.ImportedBackupBundleResult
 import com.billstracer.android.model.ThemeColor
@@ -32,6 +33,7 @@ data class SettingsUiState(
     val configDrafts: Map<String, String> = emptyMap(),
     val themePreferences: ThemePreferences = ThemePreferences(),
     val themeDraft: ThemePreferences = ThemePreferences(),
+    val databaseProfile: DatabaseProfile = DatabaseProfile.DEFAULT,
     val bundledNotices: BundledNotices? = null,
     val coreVersion: VersionInfo? = null,
     val androidVersion: VersionInfo? = null,
@@ -63,11 +65,13 @@ class SettingsViewModel(
             runCatching {
                 val bundledConfigs = settingsService.loadBundledConfigs()
                 val themePreferences = settingsService.loadThemePreferences()
+                val databaseProfile = settingsService.loadDatabaseProfile()
                 val bundledNotices = settingsService.loadBundledNotices()
                 val (coreVersion, androidVersion) = settingsService.loadVersionInfo()
                 LoadedSettings(
                     bundledConfigs = bundledConfigs,
                     themePreferences = themePreferences,
+                    databaseProfile = databaseProfile,
                     bundledNotices = bundledNotices,
                     coreVersion = coreVersion,
                     androidVersion = androidVersion,
@@ -84,6 +88,7 @@ class SettingsViewModel(
                         },
                         themePreferences = loaded.themePreferences,
                         themeDraft = loaded.themePreferences,
+                        databaseProfile = loaded.databaseProfile,
                         bundledNotices = loaded.bundledNotices,
                         coreVersion = loaded.coreVersion,
                         androidVersion = loaded.androidVersion,
@@ -296,6 +301,48 @@ class SettingsViewModel(
         }
     }
 
+    fun applyDatabaseProfile(profile: DatabaseProfile) {
+        val currentState = state.value
+        if (currentState.isInitializing || currentState.isWorking || profile == currentState.databaseProfile) {
+            return
+        }
+        viewModelScope.launch {
+            val pendingMessage = "Applying the ${profile.displayName} SQLite profile..."
+            mutableState.update { current ->
+                current.copy(
+                    isWorking = true,
+                    errorMessage = null,
+                    statusMessage = pendingMessage,
+                )
+            }
+            sessionBus.publishStatus(pendingMessage)
+            runCatching { settingsService.updateDatabaseProfile(profile) }
+                .onSuccess { persistedProfile ->
+                    val message =
+                        "Applied the ${persistedProfile.displayName} SQLite profile to new database connections."
+                    sessionBus.publishStatus(message)
+                    mutableState.update { current ->
+                        current.copy(
+                            isWorking = false,
+                            databaseProfile = persistedProfile,
+                            statusMessage = message,
+                        )
+                    }
+                }
+                .onFailure { error ->
+                    val message = error.message ?: "Failed to apply the SQLite profile."
+                    sessionBus.publishError(message, "Failed to apply the SQLite profile.")
+                    mutableState.update { current ->
+                        current.copy(
+                            isWorking = false,
+                            errorMessage = message,
+                            statusMessage = "Failed to apply the SQLite profile.",
+                        )
+                    }
+                }
+        }
+    }
+
     fun exportBackupBundle(targetDocumentUri: Uri) {
         viewModelScope.launch {
             val pendingMessage =
@@ -460,6 +507,7 @@ class SettingsViewModelFactory(
 private data class LoadedSettings(
     val bundledConfigs: List<BundledConfigFile>,
     val themePreferences: ThemePreferences,
+    val databaseProfile: DatabaseProfile,
     val bundledNotices: BundledNotices,
     val coreVersion: VersionInfo,
     val androidVersion: VersionInfo,
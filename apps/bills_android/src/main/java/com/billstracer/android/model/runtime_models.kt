@@ -111,3 +111,13 @@ data class ThemePreferences(
     val mode: ThemeMode = ThemeMode.SYSTEM,
     val color: ThemeColor = ThemeColor.SLATE,
 )
+
+enum class DatabaseProfile(
+    val nativeName: String,
+    val displayName: String,
+    val description: String,
+) {
+    DEFAULT("default", "Default", "Rollback journal, synchronous=FULL."),
+    BALANCED("balanced", "Balanced", "WAL, synchronous=NORMAL, larger cache and mmap."),
+    BULK("bulk", "Bulk", "WAL, synchronous=OFF; fastest imports, SQLite is rebuildable."),
+}
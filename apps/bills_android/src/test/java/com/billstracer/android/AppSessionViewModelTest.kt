@@ -2,6 +2,7 @@ package com.billstracer.android
 
 import com.billstracer.android.app.navigation.AppSessionBus
 import com.billstracer.android.app.navigation.AppSessionViewModel
+import com.billstracer.android.model.DatabaseProfile
 import kotlinx.coroutines.Dispatchers
 import kotlinx.coroutines.ExperimentalCoroutinesApi
 import kotlinx.coroutines.test.StandardTestDispatcher
@@ -46,6 +47,22 @@ class AppSessionViewModelTest {
         assertTrue(viewModel.state.value.globalStatusMessage.isNotBlank())
     }
 
+    @Test
+    fun initializeAppliesPersistedDatabaseProfile() = runTest {
+        val settingsService = FakeSettingsService().apply {
+            savedDatabaseProfile = DatabaseProfile.BULK
+        }
+        AppSessionViewModel(
+            workspaceService = FakeWorkspaceService(),
+            settingsService = settingsService,
+            sessionBus = AppSessionBus(),
+        )
+
+        advanceUntilIdle()
+
+        assertEquals(listOf(DatabaseProfile.BULK), settingsService.appliedDatabaseProfiles)
+    }
+
     @Test
     fun initializeFailurePublishesGlobalError() = runTest {
         val viewModel = AppSessionViewModel(
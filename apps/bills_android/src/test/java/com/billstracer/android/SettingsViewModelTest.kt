@@ -8,6 +8,7 @@ import com.billstracer.android.model.ConfigFileValidationResult
 import com.billstracer.android.model.ConfigTextsValidationResult
 import com.billstracer.android.model.ConfigValidationIssue
 import com.billstracer.android.model.ConfigValidationReport
+import com.billstracer.android.model.DatabaseProfile
 import com.billstracer.android.model.ThemeColor
 import com.billstracer.android.model.ThemeMode
 import kotlinx.coroutines.Dispatchers
@@ -158,6 +159,70 @@ class SettingsViewModelTest {
         assertEquals(emeraldDarkTheme, sessionBus.state.value.themePreferences)
     }
 
+    @Test
+    fun initializeLoadsPersistedDatabaseProfile() = runTest {
+        val settingsService = FakeSettingsService().apply {
+            savedDatabaseProfile = DatabaseProfile.BALANCED
+        }
+        val viewModel = SettingsViewModel(
+            settingsService = settingsService,
+            backupService = FakeBackupService(),
+            sessionBus = AppSessionBus(),
+            workspaceDataChangeBus = WorkspaceDataChangeBus(),
+        )
+        advanceUntilIdle()
+
+        assertEquals(DatabaseProfile.BALANCED, viewModel.state.value.databaseProfile)
+        assertEquals(listOf(DatabaseProfile.BALANCED), settingsService.appliedDatabaseProfiles)
+    }
+
+    @Test
+    fun applyDatabaseProfilePersistsSelection() = runTest {
+        val settingsService = FakeSettingsService()
+        val viewModel = SettingsViewModel(
+            settingsService = settingsService,
+            backupService = FakeBackupService(),
+            sessionBus = AppSessionBus(),
+            workspaceDataChangeBus = WorkspaceDataChangeBus(),
+        )
+        advanceUntilIdle()
+
+        viewModel.applyDatabaseProfile(DatabaseProfile.BULK)
+        advanceUntilIdle()
+
+        assertEquals(DatabaseProfile.BULK, settingsService.savedDatabaseProfile)
+        assertEquals(DatabaseProfile.BULK, viewModel.state.value.databaseProfile)
+        assertEquals(
+            listOf(DatabaseProfile.DEFAULT, DatabaseProfile.BULK),
+            settingsService.appliedDatabaseProfiles,
+        )
+        assertEquals(
+            "Applied the Bulk SQLite profile to new database connections.",
+            viewModel.state.value.statusMessage,
+        )
+    }
+
+    @Test
+    fun applyDatabaseProfileKeepsSelectionWhenNativeRejects() = runTest {
+        val settingsService = FakeSettingsService().apply {
+            nextDatabaseProfileError = "Unknown database profile: bulk"
+        }
+        val viewModel = SettingsViewModel(
+            settingsService = settingsService,
+            backupService = FakeBackupService(),
+            sessionBus = AppSessionBus(),
+            workspaceDataChangeBus = WorkspaceDataChangeBus(),
+        )
+        advanceUntilIdle()
+
+        viewModel.applyDatabaseProfile(DatabaseProfile.BULK)
+        advanceUntilIdle()
+
+        assertEquals(DatabaseProfile.DEFAULT, settingsService.savedDatabaseProfile)
+        assertEquals(DatabaseProfile.DEFAULT, viewModel.state.value.databaseProfile)
+        assertEquals("Unknown database profile: bulk", viewModel.state.value.errorMessage)
+    }
+
     @Test
     fun exportBackupBundleUpdatesStatus() = runTest {
         val viewModel = SettingsViewModel(
@@ -12,6 +12,7 @@ import com.billstracer.android.model.BundledNotices
 import com.billstracer.android.model.ConfigFileValidationResult
 import com.billstracer.android.model.ConfigTextsValidationResult
 import com.billstracer.android.model.ConfigValidationReport
+import com.billstracer.android.model.DatabaseProfile
 import com.billstracer.android.model.ExportedBackupBundleResult
 import com.billstracer.android.model.ExportedParseBundleResult
 import com.billstracer.android.model.ImportedBackupBundleResult
@@ -384,6 +385,9 @@ internal class FakeSettingsService : SettingsService {
         "export_formats.toml" to "enabled_formats = [\"json\", \"md\"]\n",
     )
     var savedTheme = ThemePreferences()
+    var savedDatabaseProfile = DatabaseProfile.DEFAULT
+    val appliedDatabaseProfiles = mutableListOf<DatabaseProfile>()
+    var nextDatabaseProfileError: String? = null
     var nextConfigValidationResult = ConfigTextsValidationResult(
         ok = true,
         code = "ok",
@@ -452,6 +456,18 @@ internal class FakeSettingsService : SettingsService {
         return savedTheme
     }
 
+    override suspend fun loadDatabaseProfile(): DatabaseProfile {
+        appliedDatabaseProfiles += savedDatabaseProfile
+        return savedDatabaseProfile
+    }
+
+    override suspend fun updateDatabaseProfile(profile: DatabaseProfile): DatabaseProfile {
+        nextDatabaseProfileError?.let { message -> error(message) }
+        appliedDatabaseProfiles += profile
+        savedDatabaseProfile = profile
+        return savedDatabaseProfile
+    }
+
     override suspend fun loadBundledNotices(): BundledNotices =
         BundledNotices(
             markdownText = "# Open Source Notices\n",
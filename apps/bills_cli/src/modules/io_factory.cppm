@@ -10,6 +10,7 @@ using ::bills::io::CreateReportDbSession;
 }
 
 export {
+using ::BillInsertFailure;
 using ::BillRepository;
 using ::ReportDataGateway;
 using ::SqliteReportDbSession;
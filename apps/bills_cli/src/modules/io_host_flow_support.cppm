@@ -29,8 +29,10 @@ using ::bills::io::ParseBundleImportResult;
 using ::bills::io::PreflightImportDocuments;
 using ::bills::io::PreviewRecordDocuments;
 using ::bills::io::QueryMonthReport;
+using ::bills::io::QueryRangeReport;
 using ::bills::io::QueryYearReport;
 using ::bills::io::RenderQueryReport;
+using ::bills::io::SelectDatabaseProfile;
 using ::bills::io::ValidateDocuments;
 using ::bills::io::WriteSerializedJsonOutputs;
 using ::bills::io::WriteTemplateFiles;
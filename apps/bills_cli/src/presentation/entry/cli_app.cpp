@@ -8,6 +8,7 @@ import bill.cli.presentation.features.template_handler;
 import bill.cli.presentation.features.workspace_handler;
 import bill.cli.presentation.parsing.cli_request;
 import bill.cli.presentation.parsing.cli_parser;
+import bill.cli.deps.io_host_flow_support;
 #else
 #include <presentation/entry/cli_app.hpp>
 #include <presentation/entry/runtime_context.hpp>
@@ -92,6 +93,11 @@ auto CliApp::Run(int argc, char* argv[]) -> int {
     }
 
     const RuntimeContext context = BuildRuntimeContext();
+    if (const auto profile = bills::io::SelectDatabaseProfile(context.db_profile);
+        !profile) {
+      std::cerr << FormatError(profile.error()) << '\n';
+      return 1;
+    }
     return ExecuteRequest(*request, context) ? 0 : 1;
   } catch (const std::exception& error) {
     std::cerr << "Critical Error: " << error.what() << '\n';
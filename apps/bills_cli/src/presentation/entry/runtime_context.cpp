@@ -32,6 +32,7 @@ namespace {
 
 constexpr const char* kRuntimeWorkspaceOverrideEnv =
     "BILLS_TRACER_RUNTIME_WORKSPACE_DIR";
+constexpr const char* kDbProfileEnv = "BILLS_TRACER_DB_PROFILE";
 constexpr const char* kProjectName = "bills_tracer";
 constexpr const char* kNoticesMarkdownPath = "notices/NOTICE.md";
 constexpr const char* kNoticesJsonPath = "notices/notices.json";
@@ -145,6 +146,14 @@ auto SplitRequestedFormats(std::string_view requested_formats)
   return parts;
 }
 
+auto ResolveDbProfile() -> std::string {
+  if (const char* profile = std::getenv(kDbProfileEnv);
+      profile != nullptr && profile[0] != '\0') {
+    return profile;
+  }
+  return "default";
+}
+
 }  // namespace
 
 auto BuildRuntimeContext() -> RuntimeContext {
@@ -175,6 +184,7 @@ auto BuildRuntimeContext() -> RuntimeContext {
                               {"rst", "reST_bills"},
                               {"tex", "LaTeX_bills"},
                               {"typ", "Typst_bills"}},
+      .db_profile = ResolveDbProfile(),
   };
 }
 
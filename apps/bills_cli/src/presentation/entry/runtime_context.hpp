@@ -20,6 +20,8 @@ struct RuntimeContext {
   std::filesystem::path json_cache_dir;
   std::filesystem::path export_dir;
   std::map<std::string, std::string> format_folder_names;
+  // SQLite 性能档位，来自 BILLS_TRACER_DB_PROFILE，未设置时为 "default"。
+  std::string db_profile = "default";
 };
 
 [[nodiscard]] auto BuildRuntimeContext() -> RuntimeContext;
@@ -33,7 +33,8 @@ auto ReportHandler::Handle(const ReportRequest& request) const -> bool {
   try {
     switch (request.action) {
       case ReportAction::kShowYear:
-      case ReportAction::kShowMonth: {
+      case ReportAction::kShowMonth:
+      case ReportAction::kShowRange: {
         const auto format = ResolveSingleReportFormat(context_, request.format);
         if (!format) {
           std::cerr << terminal::kRed << "Error: " << terminal::kReset
@@ -45,9 +46,13 @@ auto ReportHandler::Handle(const ReportRequest& request) const -> bool {
         if (request.action == ReportAction::kShowYear) {
           query_result = bills::io::QueryYearReport(
               context_.default_db_path, request.primary_value);
-        } else {
+        } else if (request.action == ReportAction::kShowMonth) {
           query_result = bills::io::QueryMonthReport(
               context_.default_db_path, request.primary_value);
+        } else {
+          query_result = bills::io::QueryRangeReport(
+              context_.default_db_path, request.primary_value,
+              request.secondary_value);
         }
         if (!query_result) {
           std::cerr << terminal::kRed << "Error: " << terminal::kReset
@@ -56,8 +61,8 @@ auto ReportHandler::Handle(const ReportRequest& request) const -> bool {
         }
         if (!query_result->execution.data_found) {
           std::cerr << terminal::kRed << "Error: " << terminal::kReset
-                    << "No report data found for '" << request.primary_value
-                    << "'." << '\n';
+                    << "No report data found for '"
+                    << query_result->execution.query_value << "'." << '\n';
           return false;
         }
 
@@ -91,6 +96,7 @@ auto ReportHandler::Handle(const ReportRequest& request) const -> bool {
         export_request.format_folder_names = context_.format_folder_names;
         export_request.primary_value = request.primary_value;
         export_request.secondary_value = request.secondary_value;
+        export_request.incremental = request.incremental;
         switch (request.action) {
           case ReportAction::kExportYear:
             export_request.scope = bills::io::HostReportExportScope::kYear;
@@ -112,6 +118,7 @@ auto ReportHandler::Handle(const ReportRequest& request) const -> bool {
             break;
           case ReportAction::kShowYear:
           case ReportAction::kShowMonth:
+          case ReportAction::kShowRange:
             break;
         }
         const auto export_result = bills::io::ExportReports(export_request);
@@ -127,8 +134,12 @@ auto ReportHandler::Handle(const ReportRequest& request) const -> bool {
         }
         if (export_result->ok) {
           std::cout << "Exported " << export_result->exported_count
-                    << " report(s) to "
-                    << export_result->export_dir.string() << '\n';
+                    << " report(s) to " << export_result->export_dir.string();
+          if (request.incremental) {
+            std::cout << " (" << export_result->unchanged_count
+                      << " unchanged)";
+          }
+          std::cout << '\n';
         }
         return export_result->ok;
       }
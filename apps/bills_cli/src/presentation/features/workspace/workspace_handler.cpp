@@ -30,7 +30,12 @@ auto PrintBatchSummary(const char* title,
                        const BillWorkflowBatchResult& result) -> void {
   std::cout << title << ": processed=" << result.processed
             << ", success=" << result.success
-            << ", failure=" << result.failure << '\n';
+            << ", failure=" << result.failure;
+  if (result.unchanged > 0U || result.removed > 0U) {
+    std::cout << ", unchanged=" << result.unchanged
+              << ", removed=" << result.removed;
+  }
+  std::cout << '\n';
   for (const auto& file : result.files) {
     if (file.ok) {
       continue;
@@ -88,6 +93,20 @@ auto BuildDefaultBundlePath(const RuntimeContext& context) -> std::filesystem::p
   return context.export_dir / stream.str();
 }
 
+// 命令行显式指定的档位覆盖运行时上下文中的默认档位。
+auto ApplyDbProfileOverride(const WorkspaceRequest& request) -> bool {
+  if (!request.db_profile.has_value()) {
+    return true;
+  }
+  const auto selected = bills::io::SelectDatabaseProfile(*request.db_profile);
+  if (!selected) {
+    std::cerr << terminal::kRed << "Error: " << terminal::kReset
+              << FormatError(selected.error()) << '\n';
+    return false;
+  }
+  return true;
+}
+
 auto ResolveCliPath(const std::filesystem::path& path) -> std::filesystem::path {
   if (path.empty()) {
     return path;
@@ -163,7 +182,8 @@ auto WorkspaceHandler::Handle(const WorkspaceRequest& request) const -> bool {
   switch (request.action) {
     case WorkspaceAction::kValidate: {
       const auto result =
-          bills::io::ValidateDocuments(request.input_path, context_.config_dir);
+          bills::io::ValidateDocuments(request.input_path, context_.config_dir,
+                                       request.jobs);
       if (!result) {
         std::cerr << terminal::kRed << "Error: " << terminal::kReset
                   << FormatError(result.error()) << '\n';
@@ -174,7 +194,8 @@ auto WorkspaceHandler::Handle(const WorkspaceRequest& request) const -> bool {
     }
     case WorkspaceAction::kConvert: {
       const auto result = bills::io::ConvertDocuments(
-          request.input_path, context_.config_dir, request.write_json_cache);
+          request.input_path, context_.config_dir, request.write_json_cache,
+          request.jobs);
       if (!result) {
         std::cerr << terminal::kRed << "Error: " << terminal::kReset
                   << FormatError(result.error()) << '\n';
@@ -187,10 +208,17 @@ auto WorkspaceHandler::Handle(const WorkspaceRequest& request) const -> bool {
       return result->failure == 0U;
     }
     case WorkspaceAction::kIngest: {
+      if (!ApplyDbProfileOverride(request)) {
+        return false;
+      }
       const auto db_path = ResolveDbPath(context_, request.db_path);
       std::cout << "Database: " << db_path.string() << '\n';
+      // JSON 缓存需要每个文件的转换结果，写缓存时总是全量入库。
+      const bool incremental =
+          request.incremental_ingest && !request.write_json_cache;
       const auto result = bills::io::IngestDocuments(
-          request.input_path, context_.config_dir, db_path, request.write_json_cache);
+          request.input_path, context_.config_dir, db_path,
+          request.write_json_cache, request.jobs, incremental);
       if (!result) {
         std::cerr << terminal::kRed << "Error: " << terminal::kReset
                   << FormatError(result.error()) << '\n';
@@ -203,6 +231,9 @@ auto WorkspaceHandler::Handle(const WorkspaceRequest& request) const -> bool {
       return result->failure == 0U;
     }
     case WorkspaceAction::kImportJson: {
+      if (!ApplyDbProfileOverride(request)) {
+        return false;
+      }
       const auto db_path = ResolveDbPath(context_, request.db_path);
       std::cout << "Database: " << db_path.string() << '\n';
       const auto result = bills::io::ImportJsonDocuments(request.input_path, db_path);
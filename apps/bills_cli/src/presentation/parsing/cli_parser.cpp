@@ -20,6 +20,13 @@ namespace bills::cli {
 namespace {
 
 constexpr std::string_view kDefaultProgramName = "bills_tracer_cli";
+constexpr std::string_view kJobsDescription =
+    "Number of worker threads used to parse source records. Use 0 to match "
+    "the hardware concurrency.";
+constexpr std::string_view kDbProfileDescription =
+    "SQLite performance profile for the import step: default (rollback "
+    "journal; switches a WAL database back to journal_mode=DELETE), balanced "
+    "(WAL, synchronous=NORMAL), or bulk (WAL, synchronous=OFF).";
 constexpr std::string_view kFormatDescription =
     "Output format for the rendered or exported report. Use 'config formats' "
     "to inspect currently enabled formats.";
@@ -115,6 +122,7 @@ auto ParseCliRequest(std::string_view program_name,
   workspace->require_subcommand(1);
 
   std::string workspace_validate_path;
+  std::size_t workspace_validate_jobs = 1U;
   auto* workspace_validate = workspace->add_subcommand(
       "validate", "Validate source records under the provided path.");
   ConfigureCommand(*workspace_validate);
@@ -122,17 +130,23 @@ auto ParseCliRequest(std::string_view program_name,
       ->add_option("path", workspace_validate_path,
                    "Path to the source records directory.")
       ->required();
+  workspace_validate->add_option("--jobs", workspace_validate_jobs,
+                                 std::string(kJobsDescription));
   SetExamples(*workspace_validate,
-              {"bills_tracer_cli workspace validate <path>"});
-  workspace_validate->callback([&parsed_request, &workspace_validate_path]() {
+              {"bills_tracer_cli workspace validate <path>",
+               "bills_tracer_cli workspace validate <path> --jobs 8"});
+  workspace_validate->callback([&parsed_request, &workspace_validate_path,
+                                &workspace_validate_jobs]() {
     WorkspaceRequest request;
     request.action = WorkspaceAction::kValidate;
     request.input_path = std::filesystem::path(workspace_validate_path);
+    request.jobs = workspace_validate_jobs;
     parsed_request = CliRequest{request};
   });
 
   std::string workspace_convert_path;
   bool workspace_convert_write_json_cache = false;
+  std::size_t workspace_convert_jobs = 1U;
   auto* workspace_convert = workspace->add_subcommand(
       "convert", "Convert source records into JSON cache entries.");
   ConfigureCommand(*workspace_convert);
@@ -143,21 +157,28 @@ auto ParseCliRequest(std::string_view program_name,
   workspace_convert->add_flag(
       "--write-json-cache", workspace_convert_write_json_cache,
       "Persist converted JSON cache files under the runtime workspace.");
+  workspace_convert->add_option("--jobs", workspace_convert_jobs,
+                                std::string(kJobsDescription));
   SetExamples(*workspace_convert,
-              {"bills_tracer_cli workspace convert <path> --write-json-cache"});
+              {"bills_tracer_cli workspace convert <path> --write-json-cache",
+               "bills_tracer_cli workspace convert <path> --jobs 8"});
   workspace_convert->callback(
       [&parsed_request, &workspace_convert_path,
-       &workspace_convert_write_json_cache]() {
+       &workspace_convert_write_json_cache, &workspace_convert_jobs]() {
         WorkspaceRequest request;
         request.action = WorkspaceAction::kConvert;
         request.input_path = std::filesystem::path(workspace_convert_path);
         request.write_json_cache = workspace_convert_write_json_cache;
+        request.jobs = workspace_convert_jobs;
         parsed_request = CliRequest{request};
       });
 
   std::string workspace_ingest_path;
   std::string workspace_ingest_db;
   bool workspace_ingest_write_json_cache = false;
+  bool workspace_ingest_incremental = false;
+  std::size_t workspace_ingest_jobs = 1U;
+  std::string workspace_ingest_db_profile;
   auto* workspace_ingest = workspace->add_subcommand(
       "ingest", "Validate, convert, and import source records into the DB.");
   ConfigureCommand(*workspace_ingest);
@@ -171,14 +192,28 @@ auto ParseCliRequest(std::string_view program_name,
   workspace_ingest->add_flag(
       "--write-json-cache", workspace_ingest_write_json_cache,
       "Persist converted JSON cache files under the runtime workspace.");
+  workspace_ingest->add_flag(
+      "--incremental", workspace_ingest_incremental,
+      "Only re-ingest records changed since the last ingest, and remove "
+      "periods whose record files were deleted.");
+  workspace_ingest->add_option("--jobs", workspace_ingest_jobs,
+                               std::string(kJobsDescription));
+  workspace_ingest
+      ->add_option("--db-profile", workspace_ingest_db_profile,
+                   std::string(kDbProfileDescription))
+      ->check(CLI::IsMember({"default", "balanced", "bulk"}));
   SetExamples(
       *workspace_ingest,
       {"bills_tracer_cli workspace ingest <path>",
        "bills_tracer_cli workspace ingest <path> --db <path> "
-       "--write-json-cache"});
+       "--write-json-cache",
+       "bills_tracer_cli workspace ingest <path> --incremental",
+       "bills_tracer_cli workspace ingest <path> --jobs 8",
+       "bills_tracer_cli workspace ingest <path> --db-profile balanced"});
   workspace_ingest->callback(
       [&parsed_request, &workspace_ingest_path, &workspace_ingest_db,
-       &workspace_ingest_write_json_cache]() {
+       &workspace_ingest_write_json_cache, &workspace_ingest_incremental,
+       &workspace_ingest_jobs, &workspace_ingest_db_profile]() {
         WorkspaceRequest request;
         request.action = WorkspaceAction::kIngest;
         request.input_path = std::filesystem::path(workspace_ingest_path);
@@ -186,11 +221,17 @@ auto ParseCliRequest(std::string_view program_name,
           request.db_path = std::filesystem::path(workspace_ingest_db);
         }
         request.write_json_cache = workspace_ingest_write_json_cache;
+        request.incremental_ingest = workspace_ingest_incremental;
+        request.jobs = workspace_ingest_jobs;
+        if (!workspace_ingest_db_profile.empty()) {
+          request.db_profile = workspace_ingest_db_profile;
+        }
         parsed_request = CliRequest{request};
       });
 
   std::string workspace_import_json_path;
   std::string workspace_import_json_db;
+  std::string workspace_import_json_db_profile;
   auto* workspace_import_json = workspace->add_subcommand(
       "import-json", "Import JSON cache entries into the runtime DB.");
   ConfigureCommand(*workspace_import_json);
@@ -201,19 +242,27 @@ auto ParseCliRequest(std::string_view program_name,
   workspace_import_json->add_option(
       "--db", workspace_import_json_db,
       "Override the runtime database path for the import step.");
+  workspace_import_json
+      ->add_option("--db-profile", workspace_import_json_db_profile,
+                   std::string(kDbProfileDescription))
+      ->check(CLI::IsMember({"default", "balanced", "bulk"}));
   SetExamples(
       *workspace_import_json,
       {"bills_tracer_cli workspace import-json <path>",
-       "bills_tracer_cli workspace import-json <path> --db <path>"});
+       "bills_tracer_cli workspace import-json <path> --db <path>",
+       "bills_tracer_cli workspace import-json <path> --db-profile bulk"});
   workspace_import_json->callback(
-      [&parsed_request, &workspace_import_json_path,
-       &workspace_import_json_db]() {
+      [&parsed_request, &workspace_import_json_path, &workspace_import_json_db,
+       &workspace_import_json_db_profile]() {
         WorkspaceRequest request;
         request.action = WorkspaceAction::kImportJson;
         request.input_path = std::filesystem::path(workspace_import_json_path);
         if (!workspace_import_json_db.empty()) {
           request.db_path = std::filesystem::path(workspace_import_json_db);
         }
+        if (!workspace_import_json_db_profile.empty()) {
+          request.db_profile = workspace_import_json_db_profile;
+        }
         parsed_request = CliRequest{request};
       });
 
@@ -330,11 +379,50 @@ auto ParseCliRequest(std::string_view program_name,
     parsed_request = CliRequest{request};
   });
 
+  std::string report_show_range_start;
+  std::string report_show_range_end;
+  std::string report_show_range_format = "md";
+  auto* report_show_range = report_show->add_subcommand(
+      "range", "Render an aggregated report for an inclusive period range.");
+  ConfigureCommand(*report_show_range);
+  report_show_range
+      ->add_option("start_month", report_show_range_start,
+                   "Start month, such as 2024-01.")
+      ->required();
+  report_show_range
+      ->add_option("end_month", report_show_range_end,
+                   "End month, such as 2026-12.")
+      ->required();
+  report_show_range->add_option("--format", report_show_range_format,
+                                std::string(kFormatDescription));
+  SetExamples(
+      *report_show_range,
+      {"bills_tracer_cli report show range <YYYY-MM> <YYYY-MM>",
+       "bills_tracer_cli report show range <YYYY-MM> <YYYY-MM> --format json"});
+  report_show_range->callback(
+      [&parsed_request, &report_show_range_start, &report_show_range_end,
+       &report_show_range_format]() {
+        ReportRequest request;
+        request.action = ReportAction::kShowRange;
+        request.primary_value = report_show_range_start;
+        request.secondary_value = report_show_range_end;
+        request.format = report_show_range_format;
+        parsed_request = CliRequest{request};
+      });
+
   auto* report_export =
       report->add_subcommand("export", "Export reports into the runtime workspace.");
   ConfigureCommand(*report_export);
   report_export->require_subcommand(1);
 
+  bool report_export_incremental = false;
+  const auto add_incremental_flag =
+      [&report_export_incremental](CLI::App& command) {
+        command.add_flag("--incremental", report_export_incremental,
+                         "Skip reports whose content is unchanged since the "
+                         "last export, leaving those files untouched.");
+      };
+
   std::string report_export_year_value;
   std::string report_export_year_format;
   auto* report_export_year = report_export->add_subcommand(
@@ -346,16 +434,19 @@ auto ParseCliRequest(std::string_view program_name,
       ->required();
   report_export_year->add_option("--format", report_export_year_format,
                                  std::string(kFormatDescription));
+  add_incremental_flag(*report_export_year);
   SetExamples(
       *report_export_year,
       {"bills_tracer_cli report export year <YYYY>",
        "bills_tracer_cli report export year <YYYY> --format md,json,tex,typ"});
   report_export_year->callback(
-      [&parsed_request, &report_export_year_value, &report_export_year_format]() {
+      [&parsed_request, &report_export_incremental, &report_export_year_value,
+       &report_export_year_format]() {
         ReportRequest request;
         request.action = ReportAction::kExportYear;
         request.primary_value = report_export_year_value;
         request.format = report_export_year_format;
+        request.incremental = report_export_incremental;
         parsed_request = CliRequest{request};
       });
 
@@ -370,17 +461,19 @@ auto ParseCliRequest(std::string_view program_name,
       ->required();
   report_export_month->add_option("--format", report_export_month_format,
                                   std::string(kFormatDescription));
+  add_incremental_flag(*report_export_month);
   SetExamples(
       *report_export_month,
       {"bills_tracer_cli report export month <YYYY-MM>",
        "bills_tracer_cli report export month <YYYY-MM> --format md,json"});
   report_export_month->callback(
-      [&parsed_request, &report_export_month_value,
+      [&parsed_request, &report_export_incremental, &report_export_month_value,
        &report_export_month_format]() {
         ReportRequest request;
         request.action = ReportAction::kExportMonth;
         request.primary_value = report_export_month_value;
         request.format = report_export_month_format;
+        request.incremental = report_export_incremental;
         parsed_request = CliRequest{request};
       });
 
@@ -400,19 +493,21 @@ auto ParseCliRequest(std::string_view program_name,
       ->required();
   report_export_range->add_option("--format", report_export_range_format,
                                   std::string(kFormatDescription));
+  add_incremental_flag(*report_export_range);
   SetExamples(
       *report_export_range,
       {"bills_tracer_cli report export range <YYYY-MM> <YYYY-MM>",
        "bills_tracer_cli report export range <YYYY-MM> <YYYY-MM> --format "
        "json,typ"});
   report_export_range->callback(
-      [&parsed_request, &report_export_range_start, &report_export_range_end,
-       &report_export_range_format]() {
+      [&parsed_request, &report_export_incremental, &report_export_range_start,
+       &report_export_range_end, &report_export_range_format]() {
         ReportRequest request;
         request.action = ReportAction::kExportRange;
         request.primary_value = report_export_range_start;
         request.secondary_value = report_export_range_end;
         request.format = report_export_range_format;
+        request.incremental = report_export_incremental;
         parsed_request = CliRequest{request};
       });
 
@@ -422,15 +517,18 @@ auto ParseCliRequest(std::string_view program_name,
   ConfigureCommand(*report_export_all_months);
   report_export_all_months->add_option("--format", report_export_all_months_format,
                                        std::string(kFormatDescription));
+  add_incremental_flag(*report_export_all_months);
   SetExamples(
       *report_export_all_months,
       {"bills_tracer_cli report export all-months",
        "bills_tracer_cli report export all-months --format md,json,tex,typ"});
   report_export_all_months->callback(
-      [&parsed_request, &report_export_all_months_format]() {
+      [&parsed_request, &report_export_incremental,
+       &report_export_all_months_format]() {
         ReportRequest request;
         request.action = ReportAction::kExportAllMonths;
         request.format = report_export_all_months_format;
+        request.incremental = report_export_incremental;
         parsed_request = CliRequest{request};
       });
 
@@ -440,15 +538,18 @@ auto ParseCliRequest(std::string_view program_name,
   ConfigureCommand(*report_export_all_years);
   report_export_all_years->add_option("--format", report_export_all_years_format,
                                       std::string(kFormatDescription));
+  add_incremental_flag(*report_export_all_years);
   SetExamples(
       *report_export_all_years,
       {"bills_tracer_cli report export all-years",
        "bills_tracer_cli report export all-years --format rst,typ"});
   report_export_all_years->callback(
-      [&parsed_request, &report_export_all_years_format]() {
+      [&parsed_request, &report_export_incremental,
+       &report_export_all_years_format]() {
         ReportRequest request;
         request.action = ReportAction::kExportAllYears;
         request.format = report_export_all_years_format;
+        request.incremental = report_export_incremental;
         parsed_request = CliRequest{request};
       });
 
@@ -458,13 +559,16 @@ auto ParseCliRequest(std::string_view program_name,
   ConfigureCommand(*report_export_all);
   report_export_all->add_option("--format", report_export_all_format,
                                 std::string(kFormatDescription));
+  add_incremental_flag(*report_export_all);
   SetExamples(*report_export_all,
               {"bills_tracer_cli report export all",
                "bills_tracer_cli report export all --format md,json,tex,typ"});
-  report_export_all->callback([&parsed_request, &report_export_all_format]() {
+  report_export_all->callback([&parsed_request, &report_export_incremental,
+                               &report_export_all_format]() {
     ReportRequest request;
     request.action = ReportAction::kExportAll;
     request.format = report_export_all_format;
+    request.incremental = report_export_incremental;
     parsed_request = CliRequest{request};
   });
 
@@ -1,6 +1,7 @@
 #ifndef PRESENTATION_PARSING_CLI_REQUEST_HPP_
 #define PRESENTATION_PARSING_CLI_REQUEST_HPP_
 
+#include <cstddef>
 #include <filesystem>
 #include <optional>
 #include <string>
@@ -24,11 +25,18 @@ struct WorkspaceRequest {
   std::optional<std::filesystem::path> output_path;
   std::optional<std::filesystem::path> db_path;
   bool write_json_cache = false;
+  // ingest 时跳过指纹未变的源文件，并删除目录下已消失文件所写入的账期。
+  bool incremental_ingest = false;
+  // validate/convert/ingest 的文档解析线程数，0 表示使用硬件并发数。
+  std::size_t jobs = 1U;
+  // ingest/import-json 写库时使用的 SQLite 性能档位，未指定时沿用运行时上下文。
+  std::optional<std::string> db_profile;
 };
 
 enum class ReportAction {
   kShowYear,
   kShowMonth,
+  kShowRange,
   kExportYear,
   kExportMonth,
   kExportRange,
@@ -42,6 +50,8 @@ struct ReportRequest {
   std::string primary_value;
   std::string secondary_value;
   std::string format = "md";
+  // export 时跳过内容与上次导出一致的报表，保留原文件及其修改时间。
+  bool incremental = false;
 };
 
 enum class TemplateAction {
@@ -1,7 +1,7 @@
 include(FetchContent)
 
 if(NOT TARGET nlohmann_json::nlohmann_json AND NOT (WIN32 AND MINGW))
-    find_package(nlohmann_json QUIET)
+    find_package(nlohmann_json 3.11 QUIET)
 endif()
 if(NOT TARGET nlohmann_json::nlohmann_json)
     FetchContent_Declare(
@@ -1,5 +1,6 @@
 set(CONFIG_DIR            "${CORE_SOURCE_ROOT}/config")
 set(COMMON_DIR           "${CORE_SOURCE_ROOT}/common")
+set(DOMAIN_DIR            "${CORE_SOURCE_ROOT}/domain")
 set(INGEST_DIR            "${CORE_SOURCE_ROOT}/ingest")
 set(QUERY_DIR             "${CORE_SOURCE_ROOT}/query")
 set(REPORTING_DIR         "${CORE_SOURCE_ROOT}/reporting")
@@ -15,6 +16,7 @@ set(INGEST_SOURCES
     "${INGEST_DIR}/bill_workflow_service.cpp"
     "${INGEST_DIR}/pipeline/bills_processing_pipeline.cpp"
     "${INGEST_DIR}/convert/bills_converter.cpp"
+    "${INGEST_DIR}/transform/bills_amount_expression.cpp"
     "${INGEST_DIR}/transform/bills_content_transformer.cpp"
     "${INGEST_DIR}/transform/bills_parser.cpp"
     "${INGEST_DIR}/transform/bills_processor.cpp"
@@ -29,12 +31,18 @@ set(COMMON_SOURCES
     "${COMMON_DIR}/text_normalizer.cpp"
 )
 
+set(DOMAIN_SOURCES
+    "${DOMAIN_DIR}/bill/bill_vocabulary.cpp"
+)
+
 set(QUERY_SOURCES
     "${QUERY_DIR}/query_service.cpp"
 )
 
 set(REPORTING_SOURCES
     "${REPORTING_DIR}/report_render_service.cpp"
+    "${REPORTING_DIR}/renderers/report_json_writer.cpp"
+    "${REPORTING_DIR}/renderers/report_output_sink.cpp"
     "${REPORTING_DIR}/renderers/standard_report_renderer_registry.cpp"
     "${REPORTING_DIR}/renderers/standard_json_latex_renderer.cpp"
     "${REPORTING_DIR}/renderers/standard_json_markdown_renderer.cpp"
@@ -59,6 +67,7 @@ set(ABI_SOURCES
 
 set(CORE_SOURCES
     ${COMMON_SOURCES}
+    ${DOMAIN_SOURCES}
     ${CONFIG_SOURCES}
     ${INGEST_SOURCES}
     ${QUERY_SOURCES}
@@ -2,6 +2,7 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -324,17 +325,18 @@ auto build_standard_report_payload(const std::vector<ParsedBill>& bills,
               {"query_value", std::string(query_value)},
               {"year", report.year},
               {"matched_bills", matched_bills},
-              {"total_income", report.total_income},
-              {"total_expense", report.total_expense},
-              {"balance", report.balance},
+              {"total_income", report.total_income.ToDouble()},
+              {"total_expense", report.total_expense.ToDouble()},
+              {"balance", report.balance.ToDouble()},
               {"standard_report", Json::parse(ReportRenderService::Render(standard_report, "json"))},
               {"report_markdown", ReportRenderService::Render(standard_report, "md")}};
     Json monthly = Json::array();
     for (const auto& [month, summary] : report.monthly_summary) {
       monthly.push_back(Json{{"month", month},
-                             {"income", summary.income},
-                             {"expense", summary.expense},
-                             {"balance", summary.income + summary.expense}});
+                             {"income", summary.income.ToDouble()},
+                             {"expense", summary.expense.ToDouble()},
+                             {"balance",
+                              (summary.income + summary.expense).ToDouble()}});
     }
     data["monthly_summary"] = std::move(monthly);
     return data;
@@ -347,6 +349,8 @@ auto build_standard_report_payload(const std::vector<ParsedBill>& bills,
   report.month = parsed_month ? parsed_month->month : 0;
   std::size_t matched_bills = 0;
   std::size_t transaction_count = 0;
+  // 各账单的编号可能来自不同的扩展词表，汇总时按文本重新登记到报表词表。
+  auto vocabulary = std::make_shared<BillVocabulary>();
   for (const auto& bill : bills) {
     if (bill.year != report.year || bill.month != report.month) {
       continue;
@@ -359,13 +363,25 @@ auto build_standard_report_payload(const std::vector<ParsedBill>& bills,
     report.balance += bill.balance;
     transaction_count += bill.transactions.size();
     for (const auto& transaction : bill.transactions) {
-      auto& parent = report.aggregated_data[transaction.parent_category];
+      const BillVocabulary& bill_vocabulary = *bill.vocabulary;
+      const std::string& parent_name =
+          bill_vocabulary.Text(transaction.parent_category);
+      const std::string& sub_name =
+          bill_vocabulary.Text(transaction.sub_category);
+      auto& parent = report.aggregated_data[parent_name];
       parent.parent_total += transaction.amount;
-      auto& sub = parent.sub_categories[transaction.sub_category];
+      auto& sub = parent.sub_categories[sub_name];
       sub.sub_total += transaction.amount;
-      sub.transactions.push_back(transaction);
+      Transaction& copy = sub.transactions.emplace_back(transaction);
+      copy.parent_category = vocabulary->Intern(parent_name);
+      copy.sub_category = vocabulary->Intern(sub_name);
+      copy.source =
+          vocabulary->Intern(bill_vocabulary.Text(transaction.source));
+      copy.transaction_type = vocabulary->Intern(
+          bill_vocabulary.Text(transaction.transaction_type));
     }
   }
+  report.vocabulary = std::move(vocabulary);
   const auto standard_report = StandardReportAssembler::FromMonthly(report);
   return Json{{"query_type", "month"},
               {"query_value", std::string(query_value)},
@@ -373,9 +389,9 @@ auto build_standard_report_payload(const std::vector<ParsedBill>& bills,
               {"month", report.month},
               {"matched_bills", matched_bills},
               {"transaction_count", transaction_count},
-              {"total_income", report.total_income},
-              {"total_expense", report.total_expense},
-              {"balance", report.balance},
+              {"total_income", report.total_income.ToDouble()},
+              {"total_expense", report.total_expense.ToDouble()},
+              {"balance", report.balance.ToDouble()},
               {"remark", report.remark},
               {"standard_report", Json::parse(ReportRenderService::Render(standard_report, "json"))},
               {"report_markdown", ReportRenderService::Render(standard_report, "md")}};
@@ -0,0 +1,126 @@
+// common/parallel_for.hpp
+#ifndef COMMON_PARALLEL_FOR_H_
+#define COMMON_PARALLEL_FOR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace bills::core::common {
+
+/**
+ * @brief 把 jobs 参数解析为实际使用的线程数。
+ *
+ * jobs 为 0 时使用硬件并发数；结果不会超过任务数，且至少为 1。
+ */
+[[nodiscard]] inline auto ResolveWorkerCount(std::size_t jobs,
+                                             std::size_t task_count)
+    -> std::size_t {
+  if (jobs == 0U) {
+    jobs = std::max<std::size_t>(1U, std::thread::hardware_concurrency());
+  }
+  return std::max<std::size_t>(1U, std::min(jobs, task_count));
+}
+
+/**
+ * @brief 以 jobs 个工作线程并行执行 task(state, index)，index 取 [0, task_count)。
+ *
+ * 每个工作线程先调用一次 make_state() 创建自己的状态（例如可复用的处理管线与
+ * 暂存缓冲区），之后领取的所有任务都复用该状态，线程之间不共享可变状态。
+ * 工作线程从共享计数器动态领取下一个下标，耗时不均的任务会自动均衡。
+ * 调用方按下标写入预先分配好的结果槽位即可保持输入顺序。
+ * 任一任务抛出异常时，在所有线程结束后重新抛出下标最小的那个异常，
+ * 与串行执行时最先遇到的异常一致。
+ */
+template <typename MakeState, typename Task>
+void ParallelForEachIndexWithState(std::size_t task_count, std::size_t jobs,
+                                   MakeState&& make_state, Task&& task) {
+  const std::size_t worker_count = ResolveWorkerCount(jobs, task_count);
+  if (task_count == 0U) {
+    return;
+  }
+  if (worker_count <= 1U) {
+    auto state = make_state();
+    for (std::size_t index = 0; index < task_count; ++index) {
+      task(state, index);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next_index{0U};
+  std::atomic<bool> failed{false};
+  std::vector<std::exception_ptr> errors(task_count);
+  std::exception_ptr state_error;
+  std::atomic<bool> state_failed{false};
+  const auto run_worker = [&]() {
+    // 状态创建失败时不领取任务，由其余线程完成全部下标。
+    std::optional<decltype(make_state())> state;
+    try {
+      state.emplace(make_state());
+    } catch (...) {
+      if (!state_failed.exchange(true)) {
+        state_error = std::current_exception();
+      }
+      return;
+    }
+    while (!failed.load(std::memory_order_relaxed)) {
+      const std::size_t index =
+          next_index.fetch_add(1U, std::memory_order_relaxed);
+      if (index >= task_count) {
+        return;
+      }
+      try {
+        task(*state, index);
+      } catch (...) {
+        errors[index] = std::current_exception();
+        failed.store(true, std::memory_order_relaxed);
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(worker_count - 1U);
+  for (std::size_t worker = 1U; worker < worker_count; ++worker) {
+    // 线程数达到系统上限时不再继续创建，已启动的线程与当前线程照常领完全部下标；
+    // 异常若直接传播，已启动但未 join 的 std::thread 析构会触发 std::terminate。
+    try {
+      workers.emplace_back(run_worker);
+    } catch (const std::system_error&) {
+      break;
+    }
+  }
+  run_worker();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  for (const auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+  // 所有线程都未能创建状态时，任务没有被执行，需要把错误交给调用方。
+  if (state_error && next_index.load() < task_count) {
+    std::rethrow_exception(state_error);
+  }
+}
+
+/**
+ * @brief 无状态版本：以 jobs 个工作线程并行执行 task(index)。
+ */
+template <typename Task>
+void ParallelForEachIndex(std::size_t task_count, std::size_t jobs,
+                          Task&& task) {
+  ParallelForEachIndexWithState(
+      task_count, jobs, []() -> int { return 0; },
+      [&task](int& /*state*/, std::size_t index) { task(index); });
+}
+
+}  // namespace bills::core::common
+
+#endif  // COMMON_PARALLEL_FOR_H_
@@ -2,6 +2,7 @@
 #define COMMON_SOURCE_DOCUMENT_HPP_
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 struct SourceDocument {
@@ -11,4 +12,12 @@ struct SourceDocument {
 
 using SourceDocumentBatch = std::vector<SourceDocument>;
 
+// 不持有文本的源文档：text 通常指向内存映射的文件，使用期间必须保持有效。
+struct SourceDocumentRef {
+  std::string display_path;
+  std::string_view text;
+};
+
+using SourceDocumentRefBatch = std::vector<SourceDocumentRef>;
+
 #endif  // COMMON_SOURCE_DOCUMENT_HPP_
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace {
 
@@ -124,7 +125,7 @@ auto NormalizeLineEndings(std::string_view text) -> std::string {
 
 }  // namespace
 
-auto NormalizeBillText(std::string_view raw_bytes) -> Result<std::string> {
+auto ValidateBillText(std::string_view raw_bytes) -> Result<std::string_view> {
   if (raw_bytes.size() >= kUtf8BomSize &&
       static_cast<unsigned char>(raw_bytes[0]) == kUtf8BomByte1 &&
       static_cast<unsigned char>(raw_bytes[1]) == kUtf8BomByte2 &&
@@ -137,5 +138,35 @@ auto NormalizeBillText(std::string_view raw_bytes) -> Result<std::string> {
     return std::unexpected(validation.error());
   }
 
-  return NormalizeLineEndings(raw_bytes);
+  return raw_bytes;
+}
+
+auto NormalizeBillText(std::string_view raw_bytes) -> Result<std::string> {
+  const auto validated_text = ValidateBillText(raw_bytes);
+  if (!validated_text) {
+    return std::unexpected(validated_text.error());
+  }
+
+  return NormalizeLineEndings(*validated_text);
+}
+
+auto SplitBillTextLines(std::string_view text) -> std::vector<std::string_view> {
+  std::vector<std::string_view> lines;
+  std::size_t line_begin = 0;
+  for (std::size_t index = 0; index < text.size(); ++index) {
+    const char current = text[index];
+    if (current != '\n' && current != '\r') {
+      continue;
+    }
+    lines.push_back(text.substr(line_begin, index - line_begin));
+    if (current == '\r' && index + 1U < text.size() && text[index + 1U] == '\n') {
+      ++index;
+    }
+    line_begin = index + 1U;
+  }
+  // 与 std::getline 一致：末尾换行之后的空串不算一行。
+  if (line_begin < text.size()) {
+    lines.push_back(text.substr(line_begin));
+  }
+  return lines;
 }
@@ -3,9 +3,16 @@
 
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "common/Result.hpp"
 
 auto NormalizeBillText(std::string_view raw_bytes) -> Result<std::string>;
 
+// 去除 BOM 并校验 UTF-8，返回指向原始字节的视图（不做换行归一化，不拷贝）。
+auto ValidateBillText(std::string_view raw_bytes) -> Result<std::string_view>;
+
+// 按 \n、\r\n、\r 切分行，结果与 NormalizeBillText 后逐行 std::getline 一致。
+auto SplitBillTextLines(std::string_view text) -> std::vector<std::string_view>;
+
 #endif  // COMMON_TEXT_NORMALIZER_H_
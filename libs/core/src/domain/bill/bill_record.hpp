@@ -2,17 +2,24 @@
 #ifndef DOMAIN_BILL_BILL_RECORD_H_
 #define DOMAIN_BILL_BILL_RECORD_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "domain/bill/bill_vocabulary.hpp"
+#include "domain/bill/money.hpp"
+
+// 分类、来源与收支类型为所属账单词表中的编号；description/comment 为自由文本，
+// 仍按值保存。四个编号相邻存放，避免与 8 字节成员交错产生填充。金额以整数分
+// 保存，账单合计与数据库汇总均为精确求和。
 struct Transaction {
-  std::string parent_category;
-  std::string sub_category;
-  double amount;
+  VocabularyId parent_category = kEmptyVocabularyId;
+  VocabularyId sub_category = kEmptyVocabularyId;
+  VocabularyId source = kEmptyVocabularyId;
+  VocabularyId transaction_type = kEmptyVocabularyId;
+  Money amount;
   std::string description;
-  std::string source;
   std::string comment;
-  std::string transaction_type;
 };
 
 struct ParsedBill {
@@ -21,9 +28,11 @@ struct ParsedBill {
   int year;
   int month;
   std::vector<Transaction> transactions;
-  double total_income;
-  double total_expense;
-  double balance;
+  Money total_income;
+  Money total_expense;
+  Money balance;
+  // transactions 中各编号所属的词表；通常与 BillConfig 共享同一份。
+  std::shared_ptr<const BillVocabulary> vocabulary;
 };
 
 #endif  // DOMAIN_BILL_BILL_RECORD_H_
@@ -0,0 +1,65 @@
+// domain/bill/bill_vocabulary.cpp
+#include "domain/bill/bill_vocabulary.hpp"
+
+#include <array>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+// 解析与序列化都会用到的固定词条。
+constexpr std::array<std::string_view, 3U> kBuiltinTerms = {
+    "Income", "Expense", "manually_add"};
+
+auto EmptyText() -> const std::string& {
+  static const std::string empty;
+  return empty;
+}
+}  // namespace
+
+BillVocabulary::BillVocabulary() { InternAll(kBuiltinTerms); }
+
+BillVocabulary::BillVocabulary(std::shared_ptr<const BillVocabulary> base)
+    : base_(std::move(base)), base_size_(base_ ? base_->Size() : 0U) {}
+
+auto BillVocabulary::Intern(std::string_view text) -> VocabularyId {
+  if (const auto found = Find(text); found.has_value()) {
+    return *found;
+  }
+  if (Size() >= std::numeric_limits<VocabularyId>::max()) {
+    throw std::length_error("BillVocabulary 词条数超出编号范围。");
+  }
+  const auto id = static_cast<VocabularyId>(Size() + 1U);
+  ids_.emplace(terms_.emplace_back(text), id);
+  return id;
+}
+
+auto BillVocabulary::Find(std::string_view text) const
+    -> std::optional<VocabularyId> {
+  if (text.empty()) {
+    return kEmptyVocabularyId;
+  }
+  if (base_) {
+    if (const auto found = base_->Find(text); found.has_value()) {
+      return found;
+    }
+  }
+  if (const auto found = ids_.find(text); found != ids_.end()) {
+    return found->second;
+  }
+  return std::nullopt;
+}
+
+auto BillVocabulary::Text(VocabularyId id) const -> const std::string& {
+  if (id == kEmptyVocabularyId) {
+    return EmptyText();
+  }
+  const std::size_t index = id - 1U;
+  if (index < base_size_) {
+    return base_->Text(id);
+  }
+  if (index - base_size_ >= terms_.size()) {
+    throw std::out_of_range("词条编号不属于该 BillVocabulary。");
+  }
+  return terms_[index - base_size_];
+}
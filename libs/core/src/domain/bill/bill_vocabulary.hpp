@@ -0,0 +1,68 @@
+// domain/bill/bill_vocabulary.hpp
+#ifndef DOMAIN_BILL_BILL_VOCABULARY_H_
+#define DOMAIN_BILL_BILL_VOCABULARY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// 交易的分类、来源与收支类型来自小型封闭词表（validator_config 中的父/子标题、
+// Income/Expense、manually_add）。交易只保存词条编号，文本在序列化、渲染与
+// SQLite 绑定边界才经由所属词表取出。0 固定表示空文本。
+using VocabularyId = std::uint32_t;
+inline constexpr VocabularyId kEmptyVocabularyId = 0U;
+
+/**
+ * @class BillVocabulary
+ * @brief 词条文本与编号的双向字典，通常由 BillConfig 在加载配置时构建并共享。
+ *
+ * 发布给解析线程后只读，查找无需加锁。扩展词表以另一词表为基底：基底中的
+ * 词条保持原编号，新词条接在其后编号，因此基底发出的编号在扩展词表中仍然有效。
+ */
+class BillVocabulary {
+ public:
+  // 根词表，预置解析与序列化都会用到的固定词条。
+  BillVocabulary();
+  // 以 base 为基底的扩展词表，用于登记配置之外的文本。
+  explicit BillVocabulary(std::shared_ptr<const BillVocabulary> base);
+
+  // 键视图指向本词表持有的文本，复制会让视图悬空。
+  BillVocabulary(const BillVocabulary&) = delete;
+  auto operator=(const BillVocabulary&) -> BillVocabulary& = delete;
+
+  // 登记 text（若尚未登记）并返回其编号。词表发布给其他线程后不应再调用。
+  auto Intern(std::string_view text) -> VocabularyId;
+
+  template <typename Range>
+  void InternAll(const Range& terms) {
+    for (const auto& term : terms) {
+      static_cast<void>(Intern(term));
+    }
+  }
+
+  // 只读查找：空文本返回 kEmptyVocabularyId，未登记的文本返回 std::nullopt。
+  [[nodiscard]] auto Find(std::string_view text) const
+      -> std::optional<VocabularyId>;
+
+  // 编号不属于本词表时抛出 std::out_of_range。
+  [[nodiscard]] auto Text(VocabularyId id) const -> const std::string&;
+
+  // 含基底在内的词条数（不含空文本）。
+  [[nodiscard]] auto Size() const -> std::size_t {
+    return base_size_ + terms_.size();
+  }
+
+ private:
+  std::shared_ptr<const BillVocabulary> base_;
+  std::size_t base_size_ = 0U;
+  // deque 追加时不移动已有元素，ids_ 的键视图始终有效。
+  std::deque<std::string> terms_;
+  std::unordered_map<std::string_view, VocabularyId> ids_;
+};
+
+#endif  // DOMAIN_BILL_BILL_VOCABULARY_H_
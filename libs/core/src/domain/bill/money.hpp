@@ -0,0 +1,127 @@
+// domain/bill/money.hpp
+#ifndef DOMAIN_BILL_MONEY_H_
+#define DOMAIN_BILL_MONEY_H_
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <compare>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <system_error>
+
+// 以整数“分”表示的金额。算术与比较均为 constexpr 且精确，汇总结果与相加顺序
+// 无关；格式化走 std::to_chars，不依赖 iostream 的 setprecision。
+class Money {
+ public:
+  static constexpr std::int64_t kCentsPerUnit = 100;
+  // |cents| 不超过 2^53：此范围内 ToDouble() 与 FromDouble() 互为逆运算。
+  static constexpr std::int64_t kMaxCents = std::int64_t{1} << 53;
+
+  constexpr Money() = default;
+
+  [[nodiscard]] static constexpr auto FromCents(std::int64_t cents) -> Money {
+    return Money(cents);
+  }
+
+  // 舍入规则与 printf("%.2f") 一致：按 double 的精确二进制值就近舍入，
+  // 因此与历史上保留两位小数后的文本完全相同。非有限值或超出 kMaxCents
+  // 时返回 std::nullopt。
+  [[nodiscard]] static auto FromDouble(double value) -> std::optional<Money> {
+    constexpr double kMaxMagnitude =
+        static_cast<double>(kMaxCents) / static_cast<double>(kCentsPerUnit);
+    if (!std::isfinite(value) || std::fabs(value) > kMaxMagnitude) {
+      return std::nullopt;
+    }
+    std::array<char, kBufferSize> buffer{};
+    const auto [text_end, error] =
+        std::to_chars(buffer.data(), buffer.data() + buffer.size(), value,
+                      std::chars_format::fixed, kFractionDigits);
+    if (error != std::errc{}) {
+      return std::nullopt;
+    }
+    const char* cursor = buffer.data();
+    const bool negative = *cursor == '-';
+    if (negative) {
+      ++cursor;
+    }
+    std::int64_t cents = 0;
+    for (; cursor != text_end; ++cursor) {
+      if (*cursor != '.') {
+        cents = cents * 10 + (*cursor - '0');
+      }
+    }
+    if (cents > kMaxCents) {
+      return std::nullopt;
+    }
+    return Money(negative ? -cents : cents);
+  }
+
+  [[nodiscard]] constexpr auto cents() const -> std::int64_t { return cents_; }
+
+  // 分数 / 100.0 为正确舍入的除法，结果与解析 "x.yz" 文本得到的 double 相同。
+  [[nodiscard]] constexpr auto ToDouble() const -> double {
+    return static_cast<double>(cents_) / static_cast<double>(kCentsPerUnit);
+  }
+
+  constexpr auto operator+=(Money other) -> Money& {
+    cents_ += other.cents_;
+    return *this;
+  }
+  constexpr auto operator-=(Money other) -> Money& {
+    cents_ -= other.cents_;
+    return *this;
+  }
+  [[nodiscard]] constexpr auto operator-() const -> Money {
+    return Money(-cents_);
+  }
+  [[nodiscard]] friend constexpr auto operator+(Money left, Money right)
+      -> Money {
+    return left += right;
+  }
+  [[nodiscard]] friend constexpr auto operator-(Money left, Money right)
+      -> Money {
+    return left -= right;
+  }
+  friend constexpr auto operator==(Money, Money) -> bool = default;
+  friend constexpr auto operator<=>(Money, Money) = default;
+
+  // 追加 "-123.45" 形式的文本，固定两位小数。
+  void AppendTo(std::string& output) const {
+    std::array<char, kBufferSize> buffer{};
+    char* cursor = buffer.data();
+    if (cents_ < 0) {
+      *cursor++ = '-';
+    }
+    const std::uint64_t magnitude =
+        cents_ < 0 ? 0U - static_cast<std::uint64_t>(cents_)
+                   : static_cast<std::uint64_t>(cents_);
+    const std::uint64_t units = magnitude / kCentsPerUnit;
+    const auto fraction = static_cast<unsigned>(magnitude % kCentsPerUnit);
+    cursor = std::to_chars(cursor, buffer.data() + buffer.size(), units).ptr;
+    *cursor++ = '.';
+    *cursor++ = static_cast<char>('0' + fraction / 10U);
+    *cursor++ = static_cast<char>('0' + fraction % 10U);
+    output.append(buffer.data(), cursor);
+  }
+
+  [[nodiscard]] auto ToString() const -> std::string {
+    std::string output;
+    AppendTo(output);
+    return output;
+  }
+
+ private:
+  static constexpr int kFractionDigits = 2;
+  // 符号、int64 的全部整数位、小数点与两位小数。
+  static constexpr std::size_t kBufferSize =
+      std::numeric_limits<std::int64_t>::digits10 + 6U;
+
+  constexpr explicit Money(std::int64_t cents) : cents_(cents) {}
+
+  std::int64_t cents_ = 0;
+};
+
+#endif  // DOMAIN_BILL_MONEY_H_
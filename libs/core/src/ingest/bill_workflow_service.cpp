@@ -1,7 +1,12 @@
 #include "ingest/bill_workflow_service.hpp"
 
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
 #include <utility>
 
+#include "common/parallel_for.hpp"
 #include "ingest/json/bills_json_serializer.hpp"
 #include "ingest/pipeline/bills_processing_pipeline.hpp"
 #include "ingest/workflow_validation_issue_support.hpp"
@@ -37,48 +42,135 @@ auto make_failure_result(const std::string& display_path, std::string stage,
   return result;
 }
 
-template <typename FileProcessor>
-auto process_documents(const SourceDocumentBatch& documents,
-                       FileProcessor&& processor) -> BillWorkflowBatchResult {
-  BillWorkflowBatchResult batch;
-  batch.processed = documents.size();
-  batch.files.reserve(documents.size());
-
+// 持有文本的批次转换为引用视图；只复制路径，文本仍指向原批次。
+auto make_document_refs(const SourceDocumentBatch& documents)
+    -> SourceDocumentRefBatch {
+  SourceDocumentRefBatch refs;
+  refs.reserve(documents.size());
   for (const auto& document : documents) {
-    auto result = processor(document);
+    refs.push_back(SourceDocumentRef{
+        .display_path = document.display_path,
+        .text = document.text,
+    });
+  }
+  return refs;
+}
+
+auto collect_batch(std::vector<BillWorkflowFileResult> files)
+    -> BillWorkflowBatchResult {
+  BillWorkflowBatchResult batch;
+  batch.processed = files.size();
+  for (const auto& result : files) {
     if (result.ok) {
       ++batch.success;
     } else {
       ++batch.failure;
     }
-    batch.files.push_back(std::move(result));
   }
-
+  batch.files = std::move(files);
   return batch;
 }
 
+// 配置只复制一次，封装为共享只读对象；每个工作线程据此创建一个管线并跨文档复用。
+auto make_pipeline_factory(const RuntimeConfigBundle& config_bundle) {
+  return [validator_config =
+              std::make_shared<const BillConfig>(config_bundle.validator_config),
+          modifier_config = std::make_shared<const Config>(
+              config_bundle.modifier_config)]() {
+    return BillProcessingPipeline(validator_config, modifier_config);
+  };
+}
+
+// 各文档相互独立，按下标写回结果槽位，保证 files 与输入顺序一致。
+template <typename FileProcessor>
+auto process_documents_with_pipeline(std::span<const SourceDocumentRef> documents,
+                                     const RuntimeConfigBundle& config_bundle,
+                                     std::size_t jobs,
+                                     FileProcessor&& processor)
+    -> BillWorkflowBatchResult {
+  std::vector<BillWorkflowFileResult> files(documents.size());
+  bills::core::common::ParallelForEachIndexWithState(
+      documents.size(), jobs, make_pipeline_factory(config_bundle),
+      [&documents, &files, &processor](BillProcessingPipeline& pipeline,
+                                       std::size_t index) {
+        files[index] = processor(pipeline, documents[index]);
+      });
+  return collect_batch(std::move(files));
+}
+
+auto make_pipeline_failure_result(const SourceDocumentRef& document,
+                                  const BillProcessingPipeline& pipeline,
+                                  std::string_view fallback_message)
+    -> BillWorkflowFileResult {
+  const std::string failure_message = pipeline.last_failure_message().empty()
+                                          ? std::string(fallback_message)
+                                          : pipeline.last_failure_message();
+  return make_failure_result(
+      document.display_path, pipeline.last_failure_stage(), failure_message,
+      bills::core::ingest::BuildWorkflowIssues(
+          pipeline.last_failure_stage(), failure_message,
+          pipeline.last_failure_messages(), document.display_path));
+}
+
+// 批量写入仓储，并把成功或失败结果写回各文档对应的槽位。
+void insert_parsed_bills(std::span<const SourceDocumentRef> documents,
+                         const std::vector<std::size_t>& parsed_indices,
+                         const std::vector<ParsedBill>& parsed_bills,
+                         BillRepository& repository,
+                         bool include_serialized_json, const std::string& stage,
+                         std::string_view source_kind,
+                         std::vector<BillWorkflowFileResult>& files) {
+  const auto record_failure = [&](std::size_t index, const std::string& message) {
+    const SourceDocumentRef& document = documents[index];
+    files[index] = make_failure_result(
+        document.display_path, stage, message,
+        bills::core::ingest::BuildWorkflowIssues(
+            stage, message, {}, document.display_path, source_kind));
+  };
+
+  std::vector<BillInsertFailure> failures;
+  try {
+    failures = repository.InsertBills(parsed_bills);
+  } catch (const std::exception& error) {
+    for (const std::size_t index : parsed_indices) {
+      record_failure(index, error.what());
+    }
+    return;
+  }
+
+  auto failure = failures.begin();
+  for (std::size_t slot = 0; slot < parsed_bills.size(); ++slot) {
+    const std::size_t index = parsed_indices[slot];
+    if (failure != failures.end() && failure->index == slot) {
+      record_failure(index, failure->message);
+      ++failure;
+      continue;
+    }
+    files[index] = make_success_result(documents[index].display_path,
+                                       parsed_bills[slot],
+                                       include_serialized_json);
+  }
+}
+
 }  // namespace
 
 auto BillWorkflowService::Validate(const SourceDocumentBatch& documents,
-                                   const RuntimeConfigBundle& config_bundle)
-    -> BillWorkflowBatchResult {
-  return process_documents(
-      documents, [&config_bundle](const SourceDocument& document) {
-        BillProcessingPipeline pipeline(config_bundle.validator_config,
-                                        config_bundle.modifier_config);
+                                   const RuntimeConfigBundle& config_bundle,
+                                   std::size_t jobs) -> BillWorkflowBatchResult {
+  return Validate(make_document_refs(documents), config_bundle, jobs);
+}
+
+auto BillWorkflowService::Validate(std::span<const SourceDocumentRef> documents,
+                                   const RuntimeConfigBundle& config_bundle,
+                                   std::size_t jobs) -> BillWorkflowBatchResult {
+  return process_documents_with_pipeline(
+      documents, config_bundle, jobs,
+      [](BillProcessingPipeline& pipeline, const SourceDocumentRef& document) {
         ParsedBill bill;
-        if (!pipeline.validate_and_convert_content(document.text,
-                                                   document.display_path, bill)) {
-          const std::string failure_message =
-              pipeline.last_failure_message().empty()
-                  ? "Bill validation failed."
-                  : pipeline.last_failure_message();
-          return make_failure_result(
-              document.display_path, pipeline.last_failure_stage(),
-              failure_message,
-              bills::core::ingest::BuildWorkflowIssues(
-                  pipeline.last_failure_stage(), failure_message,
-                  pipeline.last_failure_messages(), document.display_path));
+        if (!pipeline.validate_and_convert_fused(document.text,
+                                                 document.display_path, bill)) {
+          return make_pipeline_failure_result(document, pipeline,
+                                              "Bill validation failed.");
         }
         return make_success_result(document.display_path, bill, false);
       });
@@ -86,25 +178,25 @@ auto BillWorkflowService::Validate(const SourceDocumentBatch& documents,
 
 auto BillWorkflowService::Convert(const SourceDocumentBatch& documents,
                                   const RuntimeConfigBundle& config_bundle,
-                                  bool include_serialized_json)
-    -> BillWorkflowBatchResult {
-  return process_documents(
-      documents, [&config_bundle, include_serialized_json](const SourceDocument& document) {
-        BillProcessingPipeline pipeline(config_bundle.validator_config,
-                                        config_bundle.modifier_config);
+                                  bool include_serialized_json,
+                                  std::size_t jobs) -> BillWorkflowBatchResult {
+  return Convert(make_document_refs(documents), config_bundle,
+                 include_serialized_json, jobs);
+}
+
+auto BillWorkflowService::Convert(std::span<const SourceDocumentRef> documents,
+                                  const RuntimeConfigBundle& config_bundle,
+                                  bool include_serialized_json,
+                                  std::size_t jobs) -> BillWorkflowBatchResult {
+  return process_documents_with_pipeline(
+      documents, config_bundle, jobs,
+      [include_serialized_json](BillProcessingPipeline& pipeline,
+                                const SourceDocumentRef& document) {
         ParsedBill bill;
-        if (!pipeline.validate_and_convert_content(document.text,
-                                                   document.display_path, bill)) {
-          const std::string failure_message =
-              pipeline.last_failure_message().empty()
-                  ? "Bill conversion failed."
-                  : pipeline.last_failure_message();
-          return make_failure_result(
-              document.display_path, pipeline.last_failure_stage(),
-              failure_message,
-              bills::core::ingest::BuildWorkflowIssues(
-                  pipeline.last_failure_stage(), failure_message,
-                  pipeline.last_failure_messages(), document.display_path));
+        if (!pipeline.validate_and_convert_fused(document.text,
+                                                 document.display_path, bill)) {
+          return make_pipeline_failure_result(document, pipeline,
+                                              "Bill conversion failed.");
         }
         return make_success_result(document.display_path, bill,
                                    include_serialized_json);
@@ -114,55 +206,75 @@ auto BillWorkflowService::Convert(const SourceDocumentBatch& documents,
 auto BillWorkflowService::Ingest(const SourceDocumentBatch& documents,
                                  const RuntimeConfigBundle& config_bundle,
                                  BillRepository& repository,
-                                 bool include_serialized_json)
+                                 bool include_serialized_json, std::size_t jobs)
     -> BillWorkflowBatchResult {
-  return process_documents(
-      documents,
-      [&config_bundle, &repository,
-       include_serialized_json](const SourceDocument& document) {
-        BillProcessingPipeline pipeline(config_bundle.validator_config,
-                                        config_bundle.modifier_config);
+  return Ingest(make_document_refs(documents), config_bundle, repository,
+                include_serialized_json, jobs);
+}
+
+auto BillWorkflowService::Ingest(std::span<const SourceDocumentRef> documents,
+                                 const RuntimeConfigBundle& config_bundle,
+                                 BillRepository& repository,
+                                 bool include_serialized_json, std::size_t jobs)
+    -> BillWorkflowBatchResult {
+  // 1. 解析阶段可并行：各工作线程复用自己的管线，只共享只读配置。
+  std::vector<std::optional<ParsedBill>> bills(documents.size());
+  std::vector<BillWorkflowFileResult> files(documents.size());
+  bills::core::common::ParallelForEachIndexWithState(
+      documents.size(), jobs, make_pipeline_factory(config_bundle),
+      [&documents, &bills, &files](BillProcessingPipeline& pipeline,
+                                   std::size_t index) {
+        const SourceDocumentRef& document = documents[index];
         ParsedBill bill;
-        if (!pipeline.validate_and_convert_content(document.text,
-                                                   document.display_path, bill)) {
-          const std::string failure_message =
-              pipeline.last_failure_message().empty()
-                  ? "Bill ingest failed."
-                  : pipeline.last_failure_message();
-          return make_failure_result(
-              document.display_path, pipeline.last_failure_stage(),
-              failure_message,
-              bills::core::ingest::BuildWorkflowIssues(
-                  pipeline.last_failure_stage(), failure_message,
-                  pipeline.last_failure_messages(), document.display_path));
-        }
-        try {
-          repository.InsertBill(bill);
-        } catch (const std::exception& error) {
-          return make_failure_result(
-              document.display_path, "insert_repository", error.what(),
-              bills::core::ingest::BuildWorkflowIssues(
-                  "insert_repository", error.what(), {}, document.display_path));
+        if (!pipeline.validate_and_convert_fused(document.text,
+                                                 document.display_path, bill)) {
+          files[index] = make_pipeline_failure_result(document, pipeline,
+                                                      "Bill ingest failed.");
+          return;
         }
-        return make_success_result(document.display_path, bill,
-                                   include_serialized_json);
+        bills[index] = std::move(bill);
       });
+
+  // 2. 仓储写入按输入顺序整批提交，由仓储决定连接与事务的复用方式。
+  std::vector<std::size_t> parsed_indices;
+  std::vector<ParsedBill> parsed_bills;
+  parsed_indices.reserve(documents.size());
+  parsed_bills.reserve(documents.size());
+  for (std::size_t index = 0; index < documents.size(); ++index) {
+    if (bills[index].has_value()) {
+      parsed_indices.push_back(index);
+      parsed_bills.push_back(std::move(*bills[index]));
+    }
+  }
+  insert_parsed_bills(documents, parsed_indices, parsed_bills, repository,
+                      include_serialized_json, "insert_repository", "record_txt",
+                      files);
+  return collect_batch(std::move(files));
 }
 
 auto BillWorkflowService::ImportJson(const SourceDocumentBatch& documents,
                                      BillRepository& repository)
     -> BillWorkflowBatchResult {
-  return process_documents(documents, [&repository](const SourceDocument& document) {
+  std::vector<BillWorkflowFileResult> files(documents.size());
+  std::vector<std::size_t> parsed_indices;
+  std::vector<ParsedBill> parsed_bills;
+  parsed_indices.reserve(documents.size());
+  parsed_bills.reserve(documents.size());
+  for (std::size_t index = 0; index < documents.size(); ++index) {
+    const SourceDocument& document = documents[index];
     try {
-      const ParsedBill bill = BillJsonSerializer::deserialize(document.text);
-      repository.InsertBill(bill);
-      return make_success_result(document.display_path, bill, false);
+      parsed_bills.push_back(BillJsonSerializer::deserialize(document.text));
+      parsed_indices.push_back(index);
     } catch (const std::exception& error) {
-      return make_failure_result(
+      files[index] = make_failure_result(
           document.display_path, "import_json", error.what(),
           bills::core::ingest::BuildWorkflowIssues(
               "import_json", error.what(), {}, document.display_path,
               "record_json"));
     }
-  });
+  }
+  insert_parsed_bills(make_document_refs(documents), parsed_indices,
+                      parsed_bills, repository, false, "import_json",
+                      "record_json", files);
+  return collect_batch(std::move(files));
 }
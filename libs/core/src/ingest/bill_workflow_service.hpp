@@ -1,6 +1,8 @@
 #ifndef INGEST_BILL_WORKFLOW_SERVICE_HPP_
 #define INGEST_BILL_WORKFLOW_SERVICE_HPP_
 
+#include <cstddef>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -27,24 +29,49 @@ struct BillWorkflowBatchResult {
   std::size_t processed = 0;
   std::size_t success = 0;
   std::size_t failure = 0;
+  // 增量入库时指纹未变而跳过的文件数，以及随源文件消失而删除的账期数。
+  std::size_t unchanged = 0;
+  std::size_t removed = 0;
   std::vector<BillWorkflowFileResult> files;
 };
 
+// jobs: 并行处理文档的工作线程数，0 表示使用硬件并发数，默认串行。
+// 无论线程数多少，files 始终与输入文档顺序一致；Ingest 只并行解析阶段，
+// 仓储写入仍按输入顺序串行执行。
 class BillWorkflowService {
  public:
   [[nodiscard]] static auto Validate(const SourceDocumentBatch& documents,
-                                     const RuntimeConfigBundle& config_bundle)
+                                     const RuntimeConfigBundle& config_bundle,
+                                     std::size_t jobs = 1U)
+      -> BillWorkflowBatchResult;
+  [[nodiscard]] static auto Validate(std::span<const SourceDocumentRef> documents,
+                                     const RuntimeConfigBundle& config_bundle,
+                                     std::size_t jobs = 1U)
       -> BillWorkflowBatchResult;
 
   [[nodiscard]] static auto Convert(const SourceDocumentBatch& documents,
                                     const RuntimeConfigBundle& config_bundle,
-                                    bool include_serialized_json)
+                                    bool include_serialized_json,
+                                    std::size_t jobs = 1U)
+      -> BillWorkflowBatchResult;
+  [[nodiscard]] static auto Convert(std::span<const SourceDocumentRef> documents,
+                                    const RuntimeConfigBundle& config_bundle,
+                                    bool include_serialized_json,
+                                    std::size_t jobs = 1U)
       -> BillWorkflowBatchResult;
 
   [[nodiscard]] static auto Ingest(const SourceDocumentBatch& documents,
                                    const RuntimeConfigBundle& config_bundle,
                                    BillRepository& repository,
-                                   bool include_serialized_json)
+                                   bool include_serialized_json,
+                                   std::size_t jobs = 1U)
+      -> BillWorkflowBatchResult;
+  // 直接解析调用方持有的字节（如内存映射文件），不复制文档文本。
+  [[nodiscard]] static auto Ingest(std::span<const SourceDocumentRef> documents,
+                                   const RuntimeConfigBundle& config_bundle,
+                                   BillRepository& repository,
+                                   bool include_serialized_json,
+                                   std::size_t jobs = 1U)
       -> BillWorkflowBatchResult;
 
   [[nodiscard]] static auto ImportJson(const SourceDocumentBatch& documents,
@@ -2,12 +2,22 @@
 
 #include "bills_converter.hpp"
 
-#include "ingest/transform/bills_content_transformer.hpp"
+#include <utility>
 
-BillConverter::BillConverter(Config config) : m_config(std::move(config)) {}
+BillConverter::BillConverter(Config config)
+    : BillConverter(std::make_shared<const Config>(std::move(config)),
+                    std::make_shared<const BillVocabulary>()) {}
+
+BillConverter::BillConverter(std::shared_ptr<const Config> config,
+                             std::shared_ptr<const BillVocabulary> vocabulary)
+    : m_config(std::move(config)),
+      m_transformer(*m_config, std::move(vocabulary)) {}
 
 auto BillConverter::convert(const std::string& bill_content) -> ParsedBill {
-  BillContentTransformer processor(m_config);
-  return processor.process(bill_content);
+  return m_transformer.process(bill_content);
 }
 
+auto BillConverter::convert_lines(std::vector<std::string_view> lines)
+    -> ParsedBill {
+  return m_transformer.process_lines(std::move(lines));
+}
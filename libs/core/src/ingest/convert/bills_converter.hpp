@@ -2,19 +2,30 @@
 #ifndef INGEST_CONVERT_BILLS_CONVERTER_H_
 #define INGEST_CONVERT_BILLS_CONVERTER_H_
 
+#include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "domain/bill/bill_record.hpp"
 #include "config/modifier_data.hpp"
+#include "ingest/transform/bills_content_transformer.hpp"
 
 class BillConverter {
  public:
+  // 未提供分类词表时使用只含固定词条的根词表，分类标题登记在各账单的扩展词表中。
   explicit BillConverter(Config config);
+  // 共享只读配置与词表；转换器本身只持有可复用的暂存缓冲区。
+  BillConverter(std::shared_ptr<const Config> config,
+                std::shared_ptr<const BillVocabulary> vocabulary);
 
   ParsedBill convert(const std::string& bill_content);
+  // 单遍摄取路径：lines 为指向原始文本的行视图。
+  ParsedBill convert_lines(std::vector<std::string_view> lines);
 
  private:
-  Config m_config;
+  std::shared_ptr<const Config> m_config;
+  BillContentTransformer m_transformer;
 };
 
 #endif  // INGEST_CONVERT_BILLS_CONVERTER_H_
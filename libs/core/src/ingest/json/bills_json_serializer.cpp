@@ -3,16 +3,14 @@
 #include "bills_json_serializer.hpp"
 
 #include <cctype>
-#include <iomanip>
+#include <memory>
 #include <optional>
-#include <sstream>
 #include <stdexcept>
 #include <unordered_map>
 #include <vector>
 
 namespace {
 constexpr int kIndentSpaces = 4;
-constexpr int kMoneyPrecision = 2;
 constexpr std::size_t kIsoMonthLength = 7U;
 constexpr std::size_t kYearDigits = 4U;
 constexpr std::size_t kMonthStart = 5U;
@@ -25,10 +23,14 @@ struct IsoMonth {
   int month = 0;
 };
 
-auto FormatMoney(double value) -> nlohmann::json {
-  std::stringstream money_stream;
-  money_stream << std::fixed << std::setprecision(kMoneyPrecision) << value;
-  return nlohmann::json::parse(money_stream.str());
+// JSON 中的金额为 number；读入时按两位小数舍入到分，超出 Money 可表示
+// 范围（或非有限值）视为数据错误。
+auto ReadMoney(const nlohmann::json& node) -> Money {
+  const auto kAmount = Money::FromDouble(node.get<double>());
+  if (!kAmount.has_value()) {
+    throw std::runtime_error("JSON 中的金额超出可表示范围。");
+  }
+  return *kAmount;
 }
 
 auto IsAsciiDigit(char character) -> bool {
@@ -85,9 +87,9 @@ auto BillJsonSerializer::deserialize_json(const nlohmann::json& data)
     bill_data.date = kDateStr;
     bill_data.remark = data.at("remark").get<std::string>();
 
-    bill_data.total_income = data.at("total_income").get<double>();
-    bill_data.total_expense = data.at("total_expense").get<double>();
-    bill_data.balance = data.at("balance").get<double>();
+    bill_data.total_income = ReadMoney(data.at("total_income"));
+    bill_data.total_expense = ReadMoney(data.at("total_expense"));
+    bill_data.balance = ReadMoney(data.at("balance"));
 
     const auto kParsedMonth = ParseIsoMonth(kDateStr);
     if (!kParsedMonth.has_value()) {
@@ -96,9 +98,12 @@ auto BillJsonSerializer::deserialize_json(const nlohmann::json& data)
     bill_data.year = kParsedMonth->year;
     bill_data.month = kParsedMonth->month;
 
+    // 无配置可用：分类文本登记在该账单自己的词表中。
+    auto vocabulary = std::make_shared<BillVocabulary>();
     const auto& categories = data.at("categories");
     for (const auto& parent_item : categories.items()) {
-      const std::string& parent_category = parent_item.key();
+      const VocabularyId parent_category =
+          vocabulary->Intern(parent_item.key());
       const auto& parent_data = parent_item.value();
 
       if (!parent_data.contains("transactions") ||
@@ -110,10 +115,12 @@ auto BillJsonSerializer::deserialize_json(const nlohmann::json& data)
       for (const auto& item : transactions_json) {
         Transaction transaction{};
         transaction.parent_category = parent_category;
-        transaction.sub_category = item.at("sub_category").get<std::string>();
+        transaction.sub_category = vocabulary->Intern(
+            item.at("sub_category").get_ref<const std::string&>());
         transaction.description = item.at("description").get<std::string>();
-        transaction.amount = item.at("amount").get<double>();
-        transaction.source = item.value("source", "manually_add");
+        transaction.amount = ReadMoney(item.at("amount"));
+        transaction.source =
+            vocabulary->Intern(item.value("source", "manually_add"));
 
         if (item.contains("comment") && !item.at("comment").is_null()) {
           transaction.comment = item.at("comment").get<std::string>();
@@ -122,11 +129,12 @@ auto BillJsonSerializer::deserialize_json(const nlohmann::json& data)
         }
 
         transaction.transaction_type =
-            item.value("transaction_type", "Expense");
+            vocabulary->Intern(item.value("transaction_type", "Expense"));
 
-        bill_data.transactions.push_back(transaction);
+        bill_data.transactions.push_back(std::move(transaction));
       }
     }
+    bill_data.vocabulary = std::move(vocabulary);
   } catch (const nlohmann::json::exception& e) {
     throw std::runtime_error("JSON 数据结构不符合预期: " +
                              std::string(e.what()));
@@ -141,17 +149,18 @@ auto BillJsonSerializer::to_json(const ParsedBill& bill_data)
 
   root["date"] = bill_data.date;
   root["remark"] = bill_data.remark;
-  root["total_income"] = FormatMoney(bill_data.total_income);
-  root["total_expense"] = FormatMoney(bill_data.total_expense);
-  root["balance"] = FormatMoney(bill_data.balance);
+  root["total_income"] = bill_data.total_income.ToDouble();
+  root["total_expense"] = bill_data.total_expense.ToDouble();
+  root["balance"] = bill_data.balance.ToDouble();
 
   struct ParentAggregate {
     nlohmann::ordered_json transactions = nlohmann::ordered_json::array();
-    double sub_total = 0.0;
+    Money sub_total;
   };
 
-  std::unordered_map<std::string, ParentAggregate> parents;
-  std::vector<std::string> parent_order;
+  // 按父分类编号分组，文本只在写出 JSON 时从词表取出。
+  std::unordered_map<VocabularyId, ParentAggregate> parents;
+  std::vector<VocabularyId> parent_order;
 
   for (const auto& transaction : bill_data.transactions) {
     auto parent_it = parents.find(transaction.parent_category);
@@ -161,12 +170,15 @@ auto BillJsonSerializer::to_json(const ParsedBill& bill_data)
           parents.emplace(transaction.parent_category, ParentAggregate{}).first;
     }
 
+    const BillVocabulary& vocabulary = *bill_data.vocabulary;
     nlohmann::ordered_json transaction_node;
-    transaction_node["sub_category"] = transaction.sub_category;
+    transaction_node["sub_category"] =
+        vocabulary.Text(transaction.sub_category);
     transaction_node["description"] = transaction.description;
-    transaction_node["amount"] = transaction.amount;
-    transaction_node["source"] = transaction.source;
-    transaction_node["transaction_type"] = transaction.transaction_type;
+    transaction_node["amount"] = transaction.amount.ToDouble();
+    transaction_node["source"] = vocabulary.Text(transaction.source);
+    transaction_node["transaction_type"] =
+        vocabulary.Text(transaction.transaction_type);
     if (transaction.comment.empty()) {
       transaction_node["comment"] = nullptr;
     } else {
@@ -178,11 +190,12 @@ auto BillJsonSerializer::to_json(const ParsedBill& bill_data)
   }
 
   nlohmann::ordered_json categories_obj = nlohmann::ordered_json::object();
-  for (const auto& parent_title : parent_order) {
-    const auto& aggregate = parents.at(parent_title);
+  for (const VocabularyId parent_id : parent_order) {
+    const std::string& parent_title = bill_data.vocabulary->Text(parent_id);
+    const auto& aggregate = parents.at(parent_id);
     nlohmann::ordered_json parent_node;
     parent_node["display_name"] = parent_title;
-    parent_node["sub_total"] = FormatMoney(aggregate.sub_total);
+    parent_node["sub_total"] = aggregate.sub_total.ToDouble();
     parent_node["transactions"] = aggregate.transactions;
     categories_obj[parent_title] = parent_node;
   }
@@ -8,9 +8,17 @@
 #include "ingest/validation/validation_result.hpp"
 
 BillProcessingPipeline::BillProcessingPipeline(BillConfig validator_config,
-                                               Config modifier_config) {
+                                               Config modifier_config)
+    : BillProcessingPipeline(
+          std::make_shared<const BillConfig>(std::move(validator_config)),
+          std::make_shared<const Config>(std::move(modifier_config))) {}
+
+BillProcessingPipeline::BillProcessingPipeline(
+    std::shared_ptr<const BillConfig> validator_config,
+    std::shared_ptr<const Config> modifier_config) {
+  m_converter = std::make_unique<BillConverter>(
+      std::move(modifier_config), validator_config->vocabulary());
   m_validator = std::make_unique<BillValidator>(std::move(validator_config));
-  m_converter = std::make_unique<BillConverter>(std::move(modifier_config));
 }
 
 void BillProcessingPipeline::clear_last_failure() {
@@ -88,6 +96,41 @@ auto BillProcessingPipeline::validate_and_convert_content(
   return true;
 }
 
+auto BillProcessingPipeline::validate_and_convert_fused(
+    std::string_view bill_content, const std::string& source_name,
+    ParsedBill& bill_data) -> bool {
+  (void)source_name;
+  clear_last_failure();
+
+  // 只做 BOM 剥离与 UTF-8 校验，换行归一化由切行时一并完成。
+  const auto validated_text = ValidateBillText(bill_content);
+  if (!validated_text) {
+    set_last_failure("normalize_text", validated_text.error().message_);
+    return false;
+  }
+  std::vector<std::string_view> lines = SplitBillTextLines(*validated_text);
+
+  ValidationResult result;
+  if (!m_validator->validate_txt_structure(lines, result)) {
+    set_last_failure("validate_structure", result.error_messages());
+    return false;
+  }
+
+  try {
+    bill_data = m_converter->convert_lines(std::move(lines));
+  } catch (const std::exception& ex) {
+    set_last_failure("convert_content", ex.what());
+    return false;
+  }
+
+  result.clear();
+  if (!m_validator->validate_bill_content(bill_data, result)) {
+    set_last_failure("validate_bill", result.error_messages());
+    return false;
+  }
+  return true;
+}
+
 auto BillProcessingPipeline::convert_content(const std::string& bill_content,
                                              ParsedBill& bill_data) -> bool {
   clear_last_failure();
@@ -4,6 +4,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "domain/bill/bill_record.hpp"
@@ -21,12 +22,30 @@ class BillProcessingPipeline {
      */
   explicit BillProcessingPipeline(BillConfig validator_config,
                                   Config modifier_config);
+  /**
+   * @brief 使用共享的只读配置构造，不复制配置本身。
+   *
+   * 批处理时配置只编译一次，每个工作线程持有一个管线并跨文档复用，
+   * 管线内只保存暂存缓冲区与最近一次的失败信息。
+   */
+  BillProcessingPipeline(std::shared_ptr<const BillConfig> validator_config,
+                         std::shared_ptr<const Config> modifier_config);
 
   bool validate_content(const std::string& bill_content,
                         const std::string& source_name);
   bool validate_and_convert_content(const std::string& bill_content,
                                     const std::string& source_name,
                                     ParsedBill& bill_data);
+  /**
+   * @brief 单遍摄取：规范化、结构校验、预处理与解析共享同一组指向原始字节的
+   *        行视图，只物化最终的 ParsedBill。
+   *
+   * 结果与失败阶段（normalize_text / validate_structure / convert_content /
+   * validate_bill）均与 validate_and_convert_content 一致。
+   */
+  bool validate_and_convert_fused(std::string_view bill_content,
+                                  const std::string& source_name,
+                                  ParsedBill& bill_data);
   bool convert_content(const std::string& bill_content, ParsedBill& bill_data);
 
   [[nodiscard]] auto last_failure_stage() const -> const std::string&;
@@ -0,0 +1,204 @@
+// ingest/transform/bills_amount_expression.cpp
+
+#include "bills_amount_expression.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <system_error>
+
+namespace bills::core::ingest {
+namespace {
+
+constexpr unsigned char kUtf8TimesByte1 = 0xC3;
+constexpr unsigned char kUtf8TimesByte2 = 0x97;
+constexpr int kAmountPrecision = 2;
+// 符号 + 整数位 + 小数点 + 两位小数，另留出 inf/nan 的余量。
+constexpr std::size_t kAmountBufferSize =
+    std::numeric_limits<double>::max_exponent10 + 8U;
+
+enum CharClass : std::uint8_t {
+  kSpace = 1U << 0U,
+  kDigit = 1U << 1U,
+  kAddSub = 1U << 2U,
+  kMultiply = 1U << 3U,
+  kLineBreak = 1U << 4U,
+};
+
+// 与 "C" locale 下的 isspace/isdigit 以及旧正则中的 \s、\d 保持一致。
+constexpr auto kCharClassTable = [] {
+  std::array<std::uint8_t, 256> table{};
+  for (const unsigned char character : {' ', '\t', '\n', '\v', '\f', '\r'}) {
+    table[character] |= kSpace;
+  }
+  for (unsigned char character = '0'; character <= '9'; ++character) {
+    table[character] |= kDigit;
+  }
+  table[static_cast<unsigned char>('+')] |= kAddSub;
+  table[static_cast<unsigned char>('-')] |= kAddSub;
+  table[static_cast<unsigned char>('*')] |= kMultiply;
+  table[static_cast<unsigned char>('\n')] |= kLineBreak;
+  table[static_cast<unsigned char>('\r')] |= kLineBreak;
+  return table;
+}();
+
+[[nodiscard]] constexpr auto HasClass(char character, std::uint8_t mask)
+    -> bool {
+  return (kCharClassTable[static_cast<unsigned char>(character)] & mask) != 0U;
+}
+
+[[nodiscard]] constexpr auto SkipSpaces(std::string_view text,
+                                        std::size_t cursor) -> std::size_t {
+  while (cursor < text.size() && HasClass(text[cursor], kSpace)) {
+    ++cursor;
+  }
+  return cursor;
+}
+
+// 匹配 \d+(?:\.\d+)?，失败时返回 cursor 本身。
+[[nodiscard]] constexpr auto ScanNumber(std::string_view text,
+                                        std::size_t cursor) -> std::size_t {
+  std::size_t end = cursor;
+  while (end < text.size() && HasClass(text[end], kDigit)) {
+    ++end;
+  }
+  if (end == cursor) {
+    return cursor;
+  }
+  if (end + 1U < text.size() && text[end] == '.' &&
+      HasClass(text[end + 1U], kDigit)) {
+    end += 2U;
+    while (end < text.size() && HasClass(text[end], kDigit)) {
+      ++end;
+    }
+  }
+  return end;
+}
+
+// 识别乘号 '*' 或 UTF-8 的 '×'，返回其字节长度，不是乘号时返回 0。
+[[nodiscard]] constexpr auto MultiplyOperatorSize(std::string_view text,
+                                                  std::size_t cursor)
+    -> std::size_t {
+  if (cursor < text.size() && HasClass(text[cursor], kMultiply)) {
+    return 1U;
+  }
+  if (cursor + 1U < text.size() &&
+      static_cast<unsigned char>(text[cursor]) == kUtf8TimesByte1 &&
+      static_cast<unsigned char>(text[cursor + 1U]) == kUtf8TimesByte2) {
+    return 2U;
+  }
+  return 0U;
+}
+
+// 与 std::stod 保持一致：溢出与下溢（结果为次正规数或 0）都视为失败。
+[[nodiscard]] auto ParseFactor(std::string_view digits) -> std::optional<double> {
+  double value = 0.0;
+  const auto [kEnd, kError] =
+      std::from_chars(digits.data(), digits.data() + digits.size(), value);
+  if (kError != std::errc{}) {
+    return std::nullopt;
+  }
+  if (std::fpclassify(value) == FP_SUBNORMAL) {
+    return std::nullopt;
+  }
+  if (value == 0.0 &&
+      digits.find_first_not_of("0.") != std::string_view::npos) {
+    return std::nullopt;
+  }
+  return value;
+}
+
+}  // namespace
+
+auto EvaluateAmountExpressionLine(std::string_view line)
+    -> std::optional<AmountExpressionLine> {
+  // 语法：[+-]? \s* number ( \s* (+|-|*|×) \s* number )*
+  std::size_t cursor = 0U;
+  // 默认为支出：没有显式符号的首项取负。
+  double sign = -1.0;
+  if (!line.empty() && HasClass(line.front(), kAddSub)) {
+    sign = (line.front() == '-') ? -1.0 : 1.0;
+    cursor = 1U;
+  }
+  cursor = SkipSpaces(line, cursor);
+
+  double total_sum = 0.0;
+  double term_value = 1.0;
+  std::size_t expression_end = 0U;
+  while (true) {
+    const std::size_t kNumberEnd = ScanNumber(line, cursor);
+    if (kNumberEnd == cursor) {
+      break;
+    }
+    const auto kFactor = ParseFactor(line.substr(cursor, kNumberEnd - cursor));
+    // 与旧实现一致：解析失败的因子把整项置 0，但后续因子仍继续累乘。
+    term_value = kFactor ? term_value * *kFactor : 0.0;
+    expression_end = kNumberEnd;
+
+    const std::size_t kOperatorPos = SkipSpaces(line, kNumberEnd);
+    if (kOperatorPos >= line.size()) {
+      break;
+    }
+    const std::size_t kMultiplySize = MultiplyOperatorSize(line, kOperatorPos);
+    const bool kIsAddSub = HasClass(line[kOperatorPos], kAddSub);
+    if (kMultiplySize == 0U && !kIsAddSub) {
+      break;
+    }
+    const std::size_t kNextNumber = SkipSpaces(
+        line, kOperatorPos + (kIsAddSub ? 1U : kMultiplySize));
+    if (ScanNumber(line, kNextNumber) == kNextNumber) {
+      break;
+    }
+    if (kIsAddSub) {
+      total_sum += sign * term_value;
+      sign = (line[kOperatorPos] == '-') ? -1.0 : 1.0;
+      term_value = 1.0;
+    }
+    cursor = kNextNumber;
+  }
+
+  if (expression_end == 0U) {
+    return std::nullopt;
+  }
+  total_sum += sign * term_value;
+
+  // 与旧正则的 (.*) 一致：描述在第一个换行符处截止。
+  std::string_view description = line.substr(expression_end);
+  for (std::size_t index = 0; index < description.size(); ++index) {
+    if (HasClass(description[index], kLineBreak)) {
+      description = description.substr(0U, index);
+      break;
+    }
+  }
+  return AmountExpressionLine{total_sum, description};
+}
+
+void AppendFormattedAmount(double amount, std::string& output) {
+  std::array<char, kAmountBufferSize> buffer{};
+  const auto [kEnd, kError] =
+      std::to_chars(buffer.data(), buffer.data() + buffer.size(), amount,
+                    std::chars_format::fixed, kAmountPrecision);
+  output.append(buffer.data(), kError == std::errc{} ? kEnd : buffer.data());
+}
+
+auto AppendNormalizedAmountLine(std::string_view line, std::string& output)
+    -> bool {
+  const auto kEvaluated = EvaluateAmountExpressionLine(line);
+  if (!kEvaluated) {
+    return false;
+  }
+
+  AppendFormattedAmount(kEvaluated->amount, output);
+
+  // 如果描述部分紧挨着数字（没有空格），补充一个空格方便后续解析
+  const std::string_view kDescription = kEvaluated->description;
+  if (!kDescription.empty() && !HasClass(kDescription.front(), kSpace)) {
+    output.push_back(' ');
+  }
+  output.append(kDescription);
+  return true;
+}
+
+}  // namespace bills::core::ingest
@@ -0,0 +1,43 @@
+// ingest/transform/bills_amount_expression.hpp
+
+#ifndef INGEST_TRANSFORM_BILLS_AMOUNT_EXPRESSION_H_
+#define INGEST_TRANSFORM_BILLS_AMOUNT_EXPRESSION_H_
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace bills::core::ingest {
+
+/**
+ * @brief 行首金额表达式的求值结果。
+ */
+struct AmountExpressionLine {
+  double amount = 0.0;
+  // 表达式之后的剩余文本，指向原始行。
+  std::string_view description;
+};
+
+/**
+ * @brief 求值行首的 "+ - * ×" 金额表达式（先乘后加减）。
+ *
+ * 没有显式符号时按支出处理（取负）；行首不是金额表达式时返回 std::nullopt。
+ */
+[[nodiscard]] auto EvaluateAmountExpressionLine(std::string_view line)
+    -> std::optional<AmountExpressionLine>;
+
+/**
+ * @brief 以 "%.2f" 的格式把金额追加到 output（std::to_chars，不经过流）。
+ */
+void AppendFormattedAmount(double amount, std::string& output);
+
+/**
+ * @brief 把行首表达式规范化为 "%.2f 描述" 并追加到 output。
+ * @return 行首不是金额表达式时不写入任何内容并返回 false。
+ */
+auto AppendNormalizedAmountLine(std::string_view line, std::string& output)
+    -> bool;
+
+}  // namespace bills::core::ingest
+
+#endif  // INGEST_TRANSFORM_BILLS_AMOUNT_EXPRESSION_H_
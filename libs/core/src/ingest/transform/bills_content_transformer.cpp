@@ -2,35 +2,39 @@
 
 #include "bills_content_transformer.hpp"
 
-#include <sstream>
+#include <utility>
 
-#include "bills_parser.hpp"     // --- 引入新的解析器 ---
-#include "bills_processor.hpp"  // --- 引入新的预处理器 ---
-
-BillContentTransformer::BillContentTransformer(const Config& config)
-    : m_config(config) {}
+BillContentTransformer::BillContentTransformer(
+    const Config& config, std::shared_ptr<const BillVocabulary> vocabulary)
+    : m_processor(config), m_parser(config, std::move(vocabulary)) {}
 
 auto BillContentTransformer::process(const std::string& bill_content)
     -> ParsedBill {
   // 1. 将原始字符串按行分割
-  std::vector<std::string> lines = _split_string_by_lines(bill_content);
+  return process_lines(_split_string_by_lines(bill_content));
+}
 
-  // 2. 使用 BillProcessor 对文本行进行预处理
-  BillProcessor preprocessor(m_config);
-  preprocessor.process(lines);
+auto BillContentTransformer::process_lines(std::vector<std::string_view> lines)
+    -> ParsedBill {
+  // 2. 使用 BillProcessor 对文本行进行预处理；改写后的行存放在 m_storage 中
+  m_storage.clear();
+  m_processor.process(lines, m_storage);
 
   // 3. 使用 BillParser 将处理后的行解析为结构化数据
-  BillParser parser(m_config);
-  return parser.parse(lines);
+  return m_parser.parse(lines);
 }
 
-auto BillContentTransformer::_split_string_by_lines(const std::string& str)
-    -> std::vector<std::string> {
-  std::vector<std::string> lines;
-  std::string line;
-  std::istringstream stream(str);
-  while (std::getline(stream, line)) {
-    lines.push_back(line);
+auto BillContentTransformer::_split_string_by_lines(std::string_view str)
+    -> std::vector<std::string_view> {
+  // 与 std::getline 语义一致：按 '\n' 切分，末尾换行之后的空串不算一行。
+  std::vector<std::string_view> lines;
+  while (!str.empty()) {
+    const std::size_t kLineEnd = str.find('\n');
+    lines.push_back(str.substr(0, kLineEnd));
+    if (kLineEnd == std::string_view::npos) {
+      break;
+    }
+    str.remove_prefix(kLineEnd + 1U);
   }
   return lines;
 }
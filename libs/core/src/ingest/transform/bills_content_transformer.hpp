@@ -3,11 +3,16 @@
 #ifndef INGEST_TRANSFORM_BILLS_CONTENT_TRANSFORMER_H_
 #define INGEST_TRANSFORM_BILLS_CONTENT_TRANSFORMER_H_
 
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "domain/bill/bill_record.hpp"
+#include "domain/bill/bill_vocabulary.hpp"
 #include "config/modifier_data.hpp"
+#include "ingest/transform/bills_parser.hpp"
+#include "ingest/transform/bills_processor.hpp"
 
 /**
  * @class BillContentTransformer
@@ -15,7 +20,8 @@
  */
 class BillContentTransformer {
  public:
-  explicit BillContentTransformer(const Config& config);
+  BillContentTransformer(const Config& config,
+                         std::shared_ptr<const BillVocabulary> vocabulary);
 
   /**
    * @brief 执行完整的转换流程。
@@ -24,12 +30,22 @@ class BillContentTransformer {
    */
   ParsedBill process(const std::string& bill_content);
 
+  /**
+   * @brief 对已切分好的行视图执行转换，不再拷贝整段文本或逐行字符串。
+   * @param lines 指向原始文本的行视图，转换期间必须保持有效。
+   * @return 返回最终经过处理的账单领域数据。
+   */
+  ParsedBill process_lines(std::vector<std::string_view> lines);
+
  private:
-  const Config& m_config;
+  BillProcessor m_processor;
+  BillParser m_parser;
+  // 预处理改写后的行存放区，跨文档复用以保留容量。
+  std::string m_storage;
 
   // --- Private Static Helper Functions ---
-  static std::vector<std::string> _split_string_by_lines(
-      const std::string& str);
+  static std::vector<std::string_view> _split_string_by_lines(
+      std::string_view str);
 };
 
 #endif  // INGEST_TRANSFORM_BILLS_CONTENT_TRANSFORMER_H_
@@ -4,10 +4,11 @@
 
 #include <algorithm>
 #include <cctype>
-#include <ranges>
-#include <regex>
+#include <charconv>
 #include <stdexcept>
 #include <string_view>
+#include <system_error>
+#include <utility>
 
 #include "common/iso_period.hpp"
 
@@ -18,7 +19,9 @@ constexpr std::string_view kDefaultParentTitle = "Default Parent";
 constexpr std::string_view kDefaultSource = "manually_add";
 constexpr std::string_view kIncomeType = "Income";
 constexpr std::string_view kExpenseType = "Expense";
-constexpr std::size_t kExpectedMatchSize = 3U;
+constexpr std::string_view kIncomeParentTitle = "income";
+constexpr std::string_view kCommentDelimiter = "//";
+constexpr std::string_view kTrimChars = " \t\n\r";
 
 void AppendMetadataLine(std::string& target, const std::string_view line) {
   if (!target.empty()) {
@@ -26,41 +29,132 @@ void AppendMetadataLine(std::string& target, const std::string_view line) {
   }
   target.append(line);
 }
+
+// 与 std::regex 的 \s / \d 在 "C" locale 下的字符类保持一致。
+[[nodiscard]] constexpr auto IsRegexSpace(char character) -> bool {
+  return character == ' ' || character == '\t' || character == '\n' ||
+         character == '\v' || character == '\f' || character == '\r';
+}
+
+[[nodiscard]] constexpr auto IsDigit(char character) -> bool {
+  return character >= '0' && character <= '9';
+}
+
+[[nodiscard]] constexpr auto SkipSpaces(std::string_view text,
+                                        std::size_t cursor) -> std::size_t {
+  while (cursor < text.size() && IsRegexSpace(text[cursor])) {
+    ++cursor;
+  }
+  return cursor;
+}
+
+[[nodiscard]] constexpr auto SkipDigits(std::string_view text,
+                                        std::size_t cursor) -> std::size_t {
+  while (cursor < text.size() && IsDigit(text[cursor])) {
+    ++cursor;
+  }
+  return cursor;
+}
+
+// 匹配 \d+(?:\.\d+)?，失败时返回 cursor 本身。
+[[nodiscard]] constexpr auto ScanNumber(std::string_view text,
+                                        std::size_t cursor) -> std::size_t {
+  const std::size_t kIntegerEnd = SkipDigits(text, cursor);
+  if (kIntegerEnd == cursor) {
+    return cursor;
+  }
+  if (kIntegerEnd < text.size() && text[kIntegerEnd] == '.') {
+    const std::size_t kFractionEnd = SkipDigits(text, kIntegerEnd + 1U);
+    if (kFractionEnd > kIntegerEnd + 1U) {
+      return kFractionEnd;
+    }
+  }
+  return kIntegerEnd;
+}
+
+// 匹配 [+-]?\s*number(?:\s*[+-]\s*number)*，返回表达式结束位置；
+// 行首不是金额表达式时返回 0。
+[[nodiscard]] constexpr auto ScanAmountExpression(std::string_view line)
+    -> std::size_t {
+  std::size_t cursor = 0U;
+  if (!line.empty() && (line.front() == '+' || line.front() == '-')) {
+    ++cursor;
+  }
+  const std::size_t kFirstNumberBegin = SkipSpaces(line, cursor);
+  std::size_t expression_end = ScanNumber(line, kFirstNumberBegin);
+  if (expression_end == kFirstNumberBegin) {
+    return 0U;
+  }
+
+  while (true) {
+    const std::size_t kOperatorPos = SkipSpaces(line, expression_end);
+    if (kOperatorPos == line.size() ||
+        (line[kOperatorPos] != '+' && line[kOperatorPos] != '-')) {
+      break;
+    }
+    const std::size_t kNumberBegin = SkipSpaces(line, kOperatorPos + 1U);
+    const std::size_t kNumberEnd = ScanNumber(line, kNumberBegin);
+    if (kNumberEnd == kNumberBegin) {
+      break;
+    }
+    expression_end = kNumberEnd;
+  }
+  return expression_end;
+}
+
+[[nodiscard]] constexpr auto EqualsIgnoreAsciiCase(std::string_view left,
+                                                   std::string_view right)
+    -> bool {
+  return std::ranges::equal(left, right, [](char lhs, char rhs) -> bool {
+    const auto kLower = [](char character) -> char {
+      return (character >= 'A' && character <= 'Z')
+                 ? static_cast<char>(character - 'A' + 'a')
+                 : character;
+    };
+    return kLower(lhs) == kLower(rhs);
+  });
+}
 }  // namespace
 
-BillParser::BillParser(const Config& config) : m_config(config) {}
+BillParser::BillParser(const Config& config,
+                       std::shared_ptr<const BillVocabulary> vocabulary)
+    : m_config(config),
+      m_vocabulary(std::move(vocabulary)),
+      m_source_id(m_vocabulary->Find(kDefaultSource).value()),
+      m_income_id(m_vocabulary->Find(kIncomeType).value()),
+      m_expense_id(m_vocabulary->Find(kExpenseType).value()) {}
 
 // NOLINTNEXTLINE(readability-function-cognitive-complexity) -- parser keeps the bill text-to-structure flow in one place.
-auto BillParser::parse(const std::vector<std::string>& lines) const
+auto BillParser::parse(const std::vector<std::string_view>& lines) const
     -> ParsedBill {
   ParsedBill bill_data{};
 
-  std::vector<std::string> temp_lines;
+  std::vector<std::string_view> temp_lines;
   temp_lines.reserve(lines.size());
 
   for (const auto& line : lines) {
     if (_is_metadata_line(line)) {
       if (line.starts_with(kDatePrefix)) {
-        bill_data.date = line.substr(kDatePrefix.size());
+        bill_data.date = std::string(line.substr(kDatePrefix.size()));
       } else if (line.starts_with(kRemarkPrefix)) {
         AppendMetadataLine(bill_data.remark, line.substr(kRemarkPrefix.size()));
       }
       continue;
     }
 
-    std::string temp = line;
-    if (!_trim(temp).empty()) {
-      temp_lines.push_back(temp);
+    const std::string_view kTrimmed = _trim(line);
+    if (!kTrimmed.empty()) {
+      temp_lines.push_back(kTrimmed);
     }
   }
 
   struct SubGroup {
-    std::string title;
-    std::vector<std::string> contents;
+    std::string_view title;
+    std::vector<std::string_view> contents;
   };
 
   struct ParentGroup {
-    std::string title;
+    std::string_view title;
     std::vector<SubGroup> sub_items;
   };
 
@@ -68,7 +162,7 @@ auto BillParser::parse(const std::vector<std::string>& lines) const
   ParentGroup* current_parent = nullptr;
   SubGroup* current_sub_item = nullptr;
 
-  for (const std::string& line : temp_lines) {
+  for (const std::string_view line : temp_lines) {
     if (_is_title(line)) {
       if (_is_parent_title(line)) {
         structure.emplace_back();
@@ -79,7 +173,7 @@ auto BillParser::parse(const std::vector<std::string>& lines) const
         if (current_parent == nullptr) {
           structure.emplace_back();
           current_parent = &structure.back();
-          current_parent->title = std::string(kDefaultParentTitle);
+          current_parent->title = kDefaultParentTitle;
         }
         current_parent->sub_items.emplace_back();
         current_sub_item = &current_parent->sub_items.back();
@@ -100,50 +194,71 @@ auto BillParser::parse(const std::vector<std::string>& lines) const
     return parent.sub_items.empty();
   });
 
-  for (auto& parent : structure) {
-    for (auto& sub_item : parent.sub_items) {
+  // 配置之外的标题（如 "Default Parent"）登记在按需创建的扩展词表中，
+  // 已登记的标题直接沿用配置词表的编号。
+  std::shared_ptr<BillVocabulary> extension;
+  const auto resolve = [&](std::string_view title) -> VocabularyId {
+    if (const auto found = m_vocabulary->Find(title); found.has_value()) {
+      return *found;
+    }
+    if (!extension) {
+      extension = std::make_shared<BillVocabulary>(m_vocabulary);
+    }
+    return extension->Intern(title);
+  };
+
+  std::vector<ContentRecord> records;
+  for (const auto& parent : structure) {
+    for (const auto& sub_item : parent.sub_items) {
+      // 每行只扫描一次：先装饰为记录再排序，生成 Transaction 时直接复用。
+      records.clear();
+      records.reserve(sub_item.contents.size());
+      for (const auto& content_line : sub_item.contents) {
+        records.push_back(
+            {content_line, _scan_content_line(parent.title, content_line)});
+      }
+
       std::ranges::sort(
-          sub_item.contents,
-          [&parent](const std::string& left_value,
-             const std::string& right_value) -> bool {
-            const double kLeftAmount =
-                _get_numeric_value_from_content(parent.title, left_value);
-            const double kRightAmount =
-                _get_numeric_value_from_content(parent.title, right_value);
-            if (kLeftAmount > kRightAmount) {
+          records,
+          [](const ContentRecord& left_value,
+             const ContentRecord& right_value) -> bool {
+            if (left_value.content.amount > right_value.content.amount) {
               return true;
             }
-            if (kLeftAmount < kRightAmount) {
+            if (left_value.content.amount < right_value.content.amount) {
               return false;
             }
-            return left_value < right_value;
+            return left_value.line < right_value.line;
           });
 
-      for (const auto& content_line : sub_item.contents) {
+      // 同一子类下的交易共用父/子分类编号，每组只查一次词表。
+      const VocabularyId parent_id = resolve(parent.title);
+      const VocabularyId sub_id = resolve(sub_item.title);
+      for (const auto& record : records) {
         Transaction transaction{};
-        transaction.parent_category = parent.title;
-        transaction.sub_category = sub_item.title;
-
-        _parse_content_line(parent.title, content_line, transaction.amount,
-                            transaction.description, transaction.comment);
-
-        transaction.source = std::string(kDefaultSource);
-        transaction.transaction_type = (transaction.amount >= 0.0)
-                                           ? std::string(kIncomeType)
-                                           : std::string(kExpenseType);
+        transaction.parent_category = parent_id;
+        transaction.sub_category = sub_id;
+        transaction.amount = record.content.amount;
+        transaction.description.assign(record.content.description);
+        transaction.comment.assign(record.content.comment);
 
-        bill_data.transactions.push_back(transaction);
+        transaction.source = m_source_id;
+        transaction.transaction_type =
+            (transaction.amount >= Money{}) ? m_income_id : m_expense_id;
 
-        if (transaction.amount >= 0.0) {
+        if (transaction.amount >= Money{}) {
           bill_data.total_income += transaction.amount;
         } else {
           bill_data.total_expense += transaction.amount;
         }
+
+        bill_data.transactions.push_back(std::move(transaction));
       }
     }
   }
 
   bill_data.balance = bill_data.total_income + bill_data.total_expense;
+  bill_data.vocabulary = extension ? extension : m_vocabulary;
 
   if (!bill_data.date.empty()) {
     const auto kParsedDate =
@@ -160,7 +275,7 @@ auto BillParser::parse(const std::vector<std::string>& lines) const
   return bill_data;
 }
 
-auto BillParser::_is_metadata_line(const std::string& line) const -> bool {
+auto BillParser::_is_metadata_line(std::string_view line) const -> bool {
   return std::ranges::any_of(
       m_config.metadata_prefixes,
       [&line](const std::string& prefix) -> bool {
@@ -168,11 +283,11 @@ auto BillParser::_is_metadata_line(const std::string& line) const -> bool {
       });
 }
 
-auto BillParser::_is_parent_title(const std::string& line) -> bool {
-  return line.find('_') == std::string::npos;
+auto BillParser::_is_parent_title(std::string_view line) -> bool {
+  return line.find('_') == std::string_view::npos;
 }
 
-auto BillParser::_is_title(const std::string& line) -> bool {
+auto BillParser::_is_title(std::string_view line) -> bool {
   if (line.empty()) {
     return false;
   }
@@ -185,72 +300,69 @@ auto BillParser::_is_title(const std::string& line) -> bool {
   return false;
 }
 
-auto BillParser::_trim(std::string& text) -> std::string& {
-  text.erase(
-      text.begin(),
-      std::ranges::find_if(text, [](unsigned char character) -> bool {
-        return !std::isspace(character);
-      }));
-  text.erase(std::ranges::find_if(
-                 std::ranges::reverse_view(text),
-                 [](unsigned char character) -> bool {
-                   return !std::isspace(character);
-                 })
-                 .base(),
-             text.end());
+auto BillParser::_trim(std::string_view text) -> std::string_view {
+  const auto kIsSpace = [](char character) -> bool {
+    return std::isspace(static_cast<unsigned char>(character)) != 0;
+  };
+  while (!text.empty() && kIsSpace(text.front())) {
+    text.remove_prefix(1U);
+  }
+  while (!text.empty() && kIsSpace(text.back())) {
+    text.remove_suffix(1U);
+  }
   return text;
 }
 
-auto BillParser::_evaluate_amount_expression(const std::string& parent_category,
-                                             const std::string& math_expr) -> double {
-  std::string s = math_expr;
-  
-  // Remove all whitespace to simplify the left-to-right math parsing
-  s.erase(std::remove_if(s.begin(), s.end(), [](unsigned char character) {
-    return std::isspace(character);
-  }), s.end());
-
-  if (s.empty()) {
+auto BillParser::_evaluate_amount_expression(std::string_view parent_category,
+                                             std::string_view math_expr) -> double {
+  // 表达式已由扫描器校验为 [+-]? number ([+-] number)*，其间可夹杂空白。
+  // 逐项 from_chars 后按从左到右的顺序累加，结果与旧的 stod 循环逐位一致。
+  std::size_t cursor = SkipSpaces(math_expr, 0U);
+  if (cursor == math_expr.size()) {
     return 0.0;
   }
 
-  // 1. Check for an explicit leading sign and then strip it for raw evaluation.
+  // 1. Check for an explicit leading sign and skip it for raw evaluation.
   //    This helps us differentiate later between "+3-4", "-3-4", and "3-4".
   bool has_explicit_plus = false;
-  
-  if (s[0] == '+') {
+  if (math_expr[cursor] == '+') {
     has_explicit_plus = true;
-    s = s.substr(1);
-  } else if (s[0] == '-') {
-    s = s.substr(1);
+    cursor = SkipSpaces(math_expr, cursor + 1U);
+  } else if (math_expr[cursor] == '-') {
+    cursor = SkipSpaces(math_expr, cursor + 1U);
   }
 
   // 2. Evaluate the text as a sequence of positive/negative numbers.
-  //    Because std::stod perfectly extracts floating point values including leading
-  //    plus or minus, we can just repeatedly call stod until the string is empty.
   double sum = 0.0;
-  while (!s.empty()) {
-    std::size_t pos = 0;
-    try {
-      sum += std::stod(s, &pos);
-      if (pos == 0) {
-          break; // Avoid infinite loop if somehow parsing fails but doesn't throw
-      }
-      s = s.substr(pos);
-    } catch (...) {
-      break; // Stop evaluating when parsing fails
+  bool negative_term = false;
+  while (cursor < math_expr.size()) {
+    const std::size_t kNumberEnd = ScanNumber(math_expr, cursor);
+    if (kNumberEnd == cursor) {
+      break;
+    }
+    double term = 0.0;
+    const auto [kParsedEnd, kError] = std::from_chars(
+        math_expr.data() + cursor, math_expr.data() + kNumberEnd, term);
+    if (kError != std::errc{}) {
+      break;
     }
+    sum += negative_term ? -term : term;
+
+    cursor = SkipSpaces(math_expr, kNumberEnd);
+    if (cursor == math_expr.size() ||
+        (math_expr[cursor] != '+' && math_expr[cursor] != '-')) {
+      break;
+    }
+    negative_term = math_expr[cursor] == '-';
+    cursor = SkipSpaces(math_expr, cursor + 1U);
   }
 
   // 3. Apply the custom sign logic rules based on the Parent Category and Explicit Sign.
   //    We match the category (case-insensitive checks, e.g. "income").
-  std::string parent_lower = parent_category;
-  std::transform(parent_lower.begin(), parent_lower.end(), parent_lower.begin(),
-                 [](unsigned char character) { return static_cast<char>(std::tolower(character)); });
 
   // Rule A: If the category is explicitly an income type, we ALWAYS force
   // a positive return value in respect to the expression internal sum.
-  if (parent_lower == "income") {
+  if (EqualsIgnoreAsciiCase(parent_category, kIncomeParentTitle)) {
     // If user writes 3-4 (sum: -1), applying a positive modifier keeps it at -1.
     return sum;
   }
@@ -267,58 +379,47 @@ auto BillParser::_evaluate_amount_expression(const std::string& parent_category,
   return -sum;
 }
 
-void BillParser::_parse_content_line(const std::string& parent_category,
-                                     const std::string& line, double& amount,
-                                     std::string& description,
-                                     std::string& comment) {
-  std::smatch match;
-  // Regex designed to capture an optional math expression up front.
-  // Group 1: The math expression (digits, optional dot, optional +/- ops, optional spaces)
-  // Group 2: The remaining description text capturing trailing input.
-  std::regex content_regex(R"(^([+-]?\s*\d+(?:\.\d+)?(?:\s*[+-]\s*\d+(?:\.\d+)?)*)\s*(.*))");
-
-  std::string full_description_part;
-
-  if (std::regex_match(line, match, content_regex) &&
-      match.size() == kExpectedMatchSize) {
-    amount = _evaluate_amount_expression(parent_category, match[1].str());
-    full_description_part = match[2].str();
-  } else {
-    amount = 0.0;
-    full_description_part = line;
+auto BillParser::_scan_content_line(std::string_view parent_category,
+                                    std::string_view line) -> ContentLine {
+  ContentLine content{};
+  std::string_view full_description_part = line;
+
+  // 等价于旧正则 ^([+-]?\s*\d+(?:\.\d+)?(?:\s*[+-]\s*\d+(?:\.\d+)?)*)\s*(.*)
+  // 的 regex_match：表达式部分贪婪匹配，剩余部分不能包含换行符。
+  const std::size_t kExpressionEnd = ScanAmountExpression(line);
+  if (kExpressionEnd != 0U) {
+    const std::string_view kRemainder =
+        line.substr(SkipSpaces(line, kExpressionEnd));
+    if (kRemainder.find_first_of("\r\n") == std::string_view::npos) {
+      // 表达式按 double 求值后只舍入一次到分，与历史上保留两位小数的结果一致。
+      const auto kAmount = Money::FromDouble(_evaluate_amount_expression(
+          parent_category, line.substr(0U, kExpressionEnd)));
+      if (!kAmount.has_value()) {
+        throw std::runtime_error("金额超出可表示范围。");
+      }
+      content.amount = *kAmount;
+      full_description_part = kRemainder;
+    }
   }
 
-  const std::string_view kCommentDelimiter = "//";
   const std::size_t kCommentPos = full_description_part.find(kCommentDelimiter);
-  if (kCommentPos != std::string::npos) {
+  std::string_view description = full_description_part.substr(0U, kCommentPos);
+  std::string_view comment;
+  if (kCommentPos != std::string_view::npos) {
     comment =
         full_description_part.substr(kCommentPos + kCommentDelimiter.size());
-    description = full_description_part.substr(0, kCommentPos);
-  } else {
-    description = full_description_part;
-    comment = "";
-  }
-
-  if (!description.empty()) {
-    const auto kEndPos = description.find_last_not_of(" \t\n\r");
-    if (kEndPos != std::string::npos) {
-      description.erase(kEndPos + 1U);
-    } else {
-      description.clear();
-    }
   }
-  comment.erase(0, comment.find_first_not_of(" \t\n\r"));
-}
 
-auto BillParser::_get_numeric_value_from_content(
-    const std::string& parent_category,
-    const std::string& content_line) -> double {
-  std::smatch match;
-  // Use the exact same math parsing regex logic to parse numerical value for sorting purposes.
-  std::regex content_regex(R"(^([+-]?\s*\d+(?:\.\d+)?(?:\s*[+-]\s*\d+(?:\.\d+)?)*)\s*(.*))");
-  if (std::regex_match(content_line, match, content_regex) &&
-      match.size() == kExpectedMatchSize) {
-    return _evaluate_amount_expression(parent_category, match[1].str());
-  }
-  return 0.0;
+  const std::size_t kDescriptionEnd = description.find_last_not_of(kTrimChars);
+  description = (kDescriptionEnd == std::string_view::npos)
+                    ? std::string_view{}
+                    : description.substr(0U, kDescriptionEnd + 1U);
+  const std::size_t kCommentBegin = comment.find_first_not_of(kTrimChars);
+  comment = (kCommentBegin == std::string_view::npos)
+                ? std::string_view{}
+                : comment.substr(kCommentBegin);
+
+  content.description = description;
+  content.comment = comment;
+  return content;
 }
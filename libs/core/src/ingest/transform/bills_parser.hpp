@@ -3,10 +3,14 @@
 #ifndef INGEST_TRANSFORM_BILLS_PARSER_H_
 #define INGEST_TRANSFORM_BILLS_PARSER_H_
 
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "domain/bill/bill_record.hpp"
+#include "domain/bill/bill_vocabulary.hpp"
+#include "domain/bill/money.hpp"
 #include "config/modifier_data.hpp"
 
 /**
@@ -15,31 +19,53 @@
  */
 class BillParser {
  public:
-  explicit BillParser(const Config& config);
+  /**
+   * @param config 预处理与解析规则。
+   * @param vocabulary 分类词表；交易以其中的编号引用分类文本，词表之外的
+   *        标题登记在该账单专属的扩展词表中。
+   */
+  BillParser(const Config& config,
+             std::shared_ptr<const BillVocabulary> vocabulary);
 
   /**
    * @brief 执行解析。
-   * @param lines 预处理过的文本行。
+   * @param lines 预处理过的文本行视图，解析期间必须保持有效。
    * @return 返回领域账单数据。
    */
-  ParsedBill parse(const std::vector<std::string>& lines) const;
+  ParsedBill parse(const std::vector<std::string_view>& lines) const;
 
  private:
+  /**
+   * @brief 单行内容的扫描结果，description/comment 指向原始行，不做拷贝。
+   */
+  struct ContentLine {
+    Money amount;
+    std::string_view description;
+    std::string_view comment;
+  };
+
+  /**
+   * @brief 排序用的装饰记录：保留原始行用于同额时的字典序比较。
+   */
+  struct ContentRecord {
+    std::string_view line;
+    ContentLine content;
+  };
+
   const Config& m_config;
+  std::shared_ptr<const BillVocabulary> m_vocabulary;
+  VocabularyId m_source_id;
+  VocabularyId m_income_id;
+  VocabularyId m_expense_id;
 
-  bool _is_metadata_line(const std::string& line) const;
-  static bool _is_parent_title(const std::string& line);
-  static bool _is_title(const std::string& line);
-  static std::string& _trim(std::string& text);
-  static double _evaluate_amount_expression(const std::string& parent_category,
-                                            const std::string& math_expr);
-  static void _parse_content_line(const std::string& parent_category,
-                                  const std::string& line, double& amount,
-                                  std::string& description,
-                                  std::string& comment);
-  static double _get_numeric_value_from_content(
-      const std::string& parent_category,
-      const std::string& content_line);
+  bool _is_metadata_line(std::string_view line) const;
+  static bool _is_parent_title(std::string_view line);
+  static bool _is_title(std::string_view line);
+  static std::string_view _trim(std::string_view text);
+  static double _evaluate_amount_expression(std::string_view parent_category,
+                                            std::string_view math_expr);
+  static ContentLine _scan_content_line(std::string_view parent_category,
+                                        std::string_view line);
 };
 
 #endif  // INGEST_TRANSFORM_BILLS_PARSER_H_
@@ -3,32 +3,72 @@
 #include "bills_processor.hpp"
 
 #include <algorithm>
-#include <iomanip>
-#include <iostream>
-#include <regex>
-#include <sstream>
+#include <cctype>
+#include <utility>
 
-namespace {
-constexpr unsigned char kUtf8TimesByte1 = 0xC3;
-constexpr unsigned char kUtf8TimesByte2 = 0x97;
-}  // namespace
+#include "bills_amount_expression.hpp"
 
 BillProcessor::BillProcessor(const Config& config) : m_config(config) {}
 
-void BillProcessor::process(std::vector<std::string>& lines) {
-  for (std::string& line : lines) {
-    _sum_up_line(line);
+void BillProcessor::process(std::vector<std::string_view>& lines,
+                            std::string& storage) {
+  // 先把所有改写结果（包括续费行）写入 storage，写完后再生成视图，
+  // 这样 storage 扩容不会让已生成的视图失效。
+  constexpr std::size_t kUnchanged = std::string::npos;
+  std::vector<std::pair<std::size_t, std::size_t>> rewritten_spans(
+      lines.size(), {kUnchanged, 0U});
+  for (std::size_t index = 0; index < lines.size(); ++index) {
+    const std::size_t kBegin = storage.size();
+    if (_sum_up_line(lines[index], storage)) {
+      rewritten_spans[index] = {kBegin, storage.size() - kBegin};
+    }
+  }
+
+  std::vector<std::pair<std::size_t, std::size_t>> renewal_spans;
+  if (m_config.auto_renewal.enabled) {
+    renewal_spans.reserve(m_config.auto_renewal.rules.size());
+    for (const auto& rule : m_config.auto_renewal.rules) {
+      const std::size_t kBegin = storage.size();
+      _append_renewal_line(rule, storage);
+      renewal_spans.emplace_back(kBegin, storage.size() - kBegin);
+    }
+  }
+
+  const std::string_view kStorageView = storage;
+  for (std::size_t index = 0; index < lines.size(); ++index) {
+    const auto& [kOffset, kSize] = rewritten_spans[index];
+    if (kOffset != kUnchanged) {
+      lines[index] = kStorageView.substr(kOffset, kSize);
+    }
+  }
+
+  std::vector<std::string_view> renewal_lines;
+  renewal_lines.reserve(renewal_spans.size());
+  for (const auto& [kOffset, kSize] : renewal_spans) {
+    renewal_lines.push_back(kStorageView.substr(kOffset, kSize));
   }
-  _apply_auto_renewal(lines);
+  _apply_auto_renewal(lines, renewal_lines);
 }
 
-void BillProcessor::_apply_auto_renewal(std::vector<std::string>& lines) {
+void BillProcessor::_append_renewal_line(const Config::AutoRenewalRule& rule,
+                                         std::string& storage) {
+  bills::core::ingest::AppendFormattedAmount(rule.amount, storage);
+  storage.push_back(' ');
+  storage += rule.description;
+  storage += "(auto-renewal)";
+}
+
+void BillProcessor::_apply_auto_renewal(
+    std::vector<std::string_view>& lines,
+    const std::vector<std::string_view>& renewal_lines) {
   if (!m_config.auto_renewal.enabled) {
     return;
   }
 
-  for (const auto& rule : m_config.auto_renewal.rules) {
-    const std::string& category_title = rule.header_location;
+  for (std::size_t rule_index = 0;
+       rule_index < m_config.auto_renewal.rules.size(); ++rule_index) {
+    const auto& rule = m_config.auto_renewal.rules[rule_index];
+    const std::string_view category_title = rule.header_location;
 
     auto category_it = std::ranges::find(lines, category_title);
     if (category_it == lines.end()) {
@@ -44,155 +84,25 @@ void BillProcessor::_apply_auto_renewal(std::vector<std::string>& lines) {
 
     bool found = false;
     for (auto it = content_start_it; it != content_end_it; ++it) {
-      if (it->find(rule.description) != std::string::npos) {
+      if (it->find(rule.description) != std::string_view::npos) {
         found = true;
         break;
       }
     }
 
     if (!found) {
-      std::stringstream line_stream;
-      line_stream << std::fixed << std::setprecision(2) << rule.amount << " "
-                  << rule.description << "(auto-renewal)";
-      lines.insert(content_end_it, line_stream.str());
+      lines.insert(content_end_it, renewal_lines[rule_index]);
     }
   }
 }
 
-// 重写此函数以处理包含加减乘法的表达式
-void BillProcessor::_sum_up_line(std::string& line) {
-  // 1. 匹配数学表达式部分和描述部分
-  // 更新正则：
-  // - 允许操作符包含 + - * ×
-  // - 使用非捕获组和或运算 (?:[+*\-]|×) 来安全匹配操作符
-  // - 注意：在 [] 中 * 是字面量，- 需要放在最后或转义。× 是多字节字符，建议用 |
-  // 分隔
-  std::regex expr_regex(
-      R"(^([+-]?\s*\d+(?:\.\d+)?(?:[\s\t]*(?:[+*\-]|×)[\s\t]*\d+(?:\.\d+)?)*)(.*))");
-  std::smatch match;
-
-  if (std::regex_search(line, match, expr_regex)) {
-    std::string expression = match[1].str();
-    std::string description = match[2].str();
-
-    if (expression.empty()) {
-      return;
-    }
-
-    // 简单检查是否包含数字
-    bool has_digit = false;
-    for (char character : expression) {
-      if (isdigit(character) != 0) {
-        has_digit = true;
-        break;
-      }
-    }
-    if (!has_digit) {
-      return;
-    }
-
-    // 2. 清理表达式：移除空白，并将 '×' 替换为 '*'
-    std::string clean_expr;
-    for (size_t i = 0; i < expression.length(); ++i) {
-      char current_char = expression[i];
-      if (std::isspace(static_cast<unsigned char>(current_char)) != 0) {
-        continue;
-      }
-
-      // 处理 UTF-8 的 '×' (0xC3 0x97)
-      if (static_cast<unsigned char>(current_char) == kUtf8TimesByte1 &&
-          i + 1 < expression.length()) {
-        if (static_cast<unsigned char>(expression[i + 1]) ==
-            kUtf8TimesByte2) {
-          clean_expr += '*';
-          i++;  // 跳过下一个字节
-          continue;
-        }
-      }
-      clean_expr += current_char;
-    }
-
-    if (clean_expr.empty()) {
-      return;
-    }
-
-    // 4. 应用“默认为支出”的规则
-    // 如果以数字或点开头，说明没有显式符号，加上 '-'
-    if ((isdigit(clean_expr[0]) != 0) || clean_expr[0] == '.') {
-      clean_expr.insert(0, 1, '-');
-    }
-
-    // 5. 解析并计算 (支持优先级：先乘后加减)
-    // 算法思路：将表达式看作多个“项”的和。项之间用 + 或 - 分隔。
-    // 例如：-30*4+1-10  分解为三项：
-    // 1. -30*4 (值 -120)
-    // 2. +1    (值 +1)
-    // 3. -10   (值 -10)
-    // 总和 = -129
-
-    double total_sum = 0.0;
-    size_t pos = 0;  // 当前解析位置
-
-    while (pos < clean_expr.length()) {
-      // 寻找当前项的结束位置（下一个 + 或 -）
-      // 从 pos + 1 开始找，因为 pos 位置本身就是当前项的符号
-      size_t next_plus = clean_expr.find('+', pos + 1);
-      size_t next_minus = clean_expr.find('-', pos + 1);
-      size_t end_of_term = std::min(
-          next_plus, next_minus);  // 如果都没找到，min 会取到 npos (即结尾)
-
-      // 提取当前项字符串 (例如 "-30*4" 或 "+1")
-      std::string term_str = clean_expr.substr(pos, end_of_term - pos);
-
-      if (!term_str.empty()) {
-        // 确定该项的符号
-        double sign = (term_str[0] == '-') ? -1.0 : 1.0;
-
-        // 提取数值部分 (去掉首位的 + 或 -)
-        std::string val_part = term_str.substr(1);
-
-        // 计算该项的乘积值
-        double term_value = 1.0;
-        if (!val_part.empty()) {
-          std::stringstream value_stream(val_part);
-          std::string segment;
-          // 按 '*' 分割并累乘
-          while (std::getline(value_stream, segment, '*')) {
-            if (!segment.empty()) {
-              try {
-                term_value *= std::stod(segment);
-              } catch (...) {
-                term_value = 0.0;
-              }
-            }
-          }
-        } else {
-          term_value = 0.0;  // 只有符号没有数字的情况
-        }
-
-        // 累加到总和
-        total_sum += sign * term_value;
-      }
-
-      // 移动到下一项
-      pos = end_of_term;
-    }
-
-    // 6. 构造新行
-    std::stringstream result_ss;
-    result_ss << std::fixed << std::setprecision(2) << total_sum;
-
-    // 如果描述部分紧挨着数字（没有空格），补充一个空格方便后续解析
-    if (!description.empty() && (isspace(description[0]) == 0)) {
-      result_ss << " ";
-    }
-
-    result_ss << description;
-    line = result_ss.str();
-  }
+// 行首表达式支持加减乘法（含 UTF-8 的 '×'），由 bills_amount_expression 求值
+auto BillProcessor::_sum_up_line(std::string_view line, std::string& output)
+    -> bool {
+  return bills::core::ingest::AppendNormalizedAmountLine(line, output);
 }
 
-auto BillProcessor::_is_title(const std::string& line) -> bool {
+auto BillProcessor::_is_title(std::string_view line) -> bool {
   if (line.empty()) {
     return false;
   }
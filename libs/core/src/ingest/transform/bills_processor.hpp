@@ -4,6 +4,7 @@
 #define INGEST_TRANSFORM_BILLS_PROCESSOR_H_
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "config/modifier_data.hpp"
@@ -20,18 +21,24 @@ class BillProcessor {
 
   /**
    * @brief 执行所有预处理修改。
-   * @param lines 原始的文本行向量，将被就地修改。
+   * @param lines 原始文本行的视图，将被就地替换为预处理后的行视图。
+   * @param storage 改写后文本的存放区；lines 中的视图可能指向这里，
+   *                调用方需保证其生命周期覆盖 lines 的使用。
    */
-  void process(std::vector<std::string>& lines);
+  void process(std::vector<std::string_view>& lines, std::string& storage);
 
  private:
   const Config& m_config;
 
-  void _apply_auto_renewal(std::vector<std::string>& lines);
-  static void _sum_up_line(std::string& line);
+  void _apply_auto_renewal(std::vector<std::string_view>& lines,
+                           const std::vector<std::string_view>& renewal_lines);
+  static void _append_renewal_line(const Config::AutoRenewalRule& rule,
+                                   std::string& storage);
+  // 行首为金额表达式时，把改写后的行追加到 output 并返回 true。
+  static bool _sum_up_line(std::string_view line, std::string& output);
   // is_title 是一个辅助函数，在 BillContentTransformer
   // 中也有，这里为了独立也保留一份
-  static bool _is_title(const std::string& line);
+  static bool _is_title(std::string_view line);
 };
 
 #endif  // INGEST_TRANSFORM_BILLS_PROCESSOR_H_
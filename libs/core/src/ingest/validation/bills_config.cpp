@@ -2,9 +2,19 @@
 
 #include "bills_config.hpp"
 
+#include <utility>
+
 BillConfig::BillConfig(BillValidationRules rules)
     : validation_map_(std::move(rules.validation_map)),
-      all_parent_titles_(std::move(rules.parent_titles)) {}
+      all_parent_titles_(std::move(rules.parent_titles)) {
+  auto vocabulary = std::make_shared<BillVocabulary>();
+  vocabulary->InternAll(all_parent_titles_);
+  for (const auto& [parent_title, sub_titles] : validation_map_) {
+    static_cast<void>(vocabulary->Intern(parent_title));
+    vocabulary->InternAll(sub_titles);
+  }
+  vocabulary_ = std::move(vocabulary);
+}
 
 auto BillConfig::is_parent_title(const std::string& title) const -> bool {
   return all_parent_titles_.contains(title);
@@ -19,3 +29,8 @@ auto BillConfig::is_valid_sub_title(const std::string& parent_title,
   const auto& sub_titles = validation_map_.at(parent_title);
   return sub_titles.contains(sub_title);
 }
+
+auto BillConfig::vocabulary() const
+    -> const std::shared_ptr<const BillVocabulary>& {
+  return vocabulary_;
+}
@@ -2,10 +2,13 @@
 #ifndef INGEST_VALIDATION_BILLS_CONFIG_H_
 #define INGEST_VALIDATION_BILLS_CONFIG_H_
 
+#include <memory>
 #include <set>
 #include <string>
 #include <unordered_map>
 
+#include "domain/bill/bill_vocabulary.hpp"
+
 struct BillValidationRules {
   std::unordered_map<std::string, std::set<std::string>> validation_map;
   std::set<std::string> parent_titles;
@@ -23,9 +26,17 @@ class BillConfig {
   bool is_valid_sub_title(const std::string& parent_title,
                           const std::string& sub_title) const;
 
+  /**
+   * @brief 由本配置的父/子标题构成的只读词表，解析时据此共享分类文本。
+   *        复制 BillConfig 只共享词表，不复制词条。
+   */
+  [[nodiscard]] auto vocabulary() const
+      -> const std::shared_ptr<const BillVocabulary>&;
+
  private:
   std::unordered_map<std::string, std::set<std::string>> validation_map_;
   std::set<std::string> all_parent_titles_;
+  std::shared_ptr<const BillVocabulary> vocabulary_;
 };
 
 #endif  // INGEST_VALIDATION_BILLS_CONFIG_H_
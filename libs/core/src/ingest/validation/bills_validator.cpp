@@ -1,27 +1,46 @@
 // ingest/validation/bills_validator.cpp
 #include "bills_validator.hpp"
 
-#include <regex>
-#include <sstream>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include "common/iso_period.hpp"
 
+namespace {
+constexpr std::string_view kRemarkPrefix = "remark:";
+}  // namespace
+
 // --- NEW: TxtStructureVerifier implementation ---
 auto TxtStructureVerifier::verify(const std::string& bill_content,
                                   ValidationResult& result) -> bool {
-  std::istringstream stream(bill_content);
-  std::string line;
+  // 只需要前两行；按 std::getline 语义切分，末尾换行后的空串不算一行。
+  std::vector<std::string_view> lines;
+  std::string_view remaining = bill_content;
+  while (lines.size() < 2U && !remaining.empty()) {
+    const std::size_t kLineEnd = remaining.find('\n');
+    lines.push_back(remaining.substr(0, kLineEnd));
+    remaining = (kLineEnd == std::string_view::npos)
+                    ? std::string_view{}
+                    : remaining.substr(kLineEnd + 1U);
+  }
+  return verify(lines, result);
+}
+
+auto TxtStructureVerifier::verify(const std::vector<std::string_view>& lines,
+                                  ValidationResult& result) -> bool {
   int line_num = 0;
 
   // Validate date
-  if (std::getline(stream, line)) {
+  if (!lines.empty()) {
     line_num++;
-    if (!bills::core::common::iso_period::extract_year_month_from_date_header(line)
+    if (!bills::core::common::iso_period::extract_year_month_from_date_header(
+             lines[0])
              .has_value()) {
       result.add_error("Error (Line " + std::to_string(line_num) +
                        "): The first line must be 'date:YYYY-MM'. Found: '" +
-                       line + "'");
+                       std::string(lines[0]) + "'");
       return false;
     }
   } else {
@@ -31,13 +50,14 @@ auto TxtStructureVerifier::verify(const std::string& bill_content,
   }
 
   // Validate remark
-  if (std::getline(stream, line)) {
+  if (lines.size() >= 2U) {
     line_num++;
-    if (!std::regex_match(line, std::regex(R"(^remark:.*)"))) {
+    // 行内不含换行符，原先的 ^remark:.* 正则等价于前缀判断。
+    if (!lines[1].starts_with(kRemarkPrefix)) {
       result.add_error(
           "Error (Line " + std::to_string(line_num) +
-          "): The second line must start with 'remark:'. Found: '" + line +
-          "'");
+          "): The second line must start with 'remark:'. Found: '" +
+          std::string(lines[1]) + "'");
       return false;
     }
   } else {
@@ -53,18 +73,20 @@ auto BillContentValidator::verify(const ParsedBill& bill_data,
                                   const BillConfig& config,
                                   ValidationResult& result) -> bool {
   for (const auto& transaction : bill_data.transactions) {
-    if (!config.is_parent_title(transaction.parent_category)) {
+    const std::string& parent_category =
+        bill_data.vocabulary->Text(transaction.parent_category);
+    const std::string& sub_category =
+        bill_data.vocabulary->Text(transaction.sub_category);
+    if (!config.is_parent_title(parent_category)) {
       result.add_error(
-          "Content Error: Parent item '" + transaction.parent_category +
+          "Content Error: Parent item '" + parent_category +
           "' is not a valid parent title defined in the configuration.");
     }
 
-    if (!config.is_valid_sub_title(transaction.parent_category,
-                                   transaction.sub_category)) {
-      result.add_error("Content Error: Sub-category '" +
-                       transaction.sub_category +
+    if (!config.is_valid_sub_title(parent_category, sub_category)) {
+      result.add_error("Content Error: Sub-category '" + sub_category +
                        "' is not a valid sub-item for parent '" +
-                       transaction.parent_category + "'.");
+                       parent_category + "'.");
     }
   }
 
@@ -73,13 +95,22 @@ auto BillContentValidator::verify(const ParsedBill& bill_data,
 
 // --- BillValidator Implementation ---
 BillValidator::BillValidator(BillConfig config)
-    : m_config(std::make_unique<BillConfig>(std::move(config))) {}
+    : m_config(std::make_shared<const BillConfig>(std::move(config))) {}
+
+BillValidator::BillValidator(std::shared_ptr<const BillConfig> config)
+    : m_config(std::move(config)) {}
 
 auto BillValidator::validate_txt_structure(const std::string& bill_content,
                                            ValidationResult& result) -> bool {
   return TxtStructureVerifier::verify(bill_content, result);
 }
 
+auto BillValidator::validate_txt_structure(
+    const std::vector<std::string_view>& lines, ValidationResult& result)
+    -> bool {
+  return TxtStructureVerifier::verify(lines, result);
+}
+
 auto BillValidator::validate_bill_content(const ParsedBill& bill_data,
                                           ValidationResult& result) -> bool {
   return BillContentValidator::verify(bill_data, *m_config, result);
@@ -4,6 +4,8 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "ingest/validation/bills_config.hpp"
 #include "ingest/validation/validation_result.hpp"
@@ -14,6 +16,9 @@
 class TxtStructureVerifier {
  public:
   static bool verify(const std::string& bill_content, ValidationResult& result);
+  // 行视图版本：供单遍摄取路径复用已切分好的行，避免再次读取整段文本。
+  static bool verify(const std::vector<std::string_view>& lines,
+                     ValidationResult& result);
 };
 
 // --- NEW: BillContentValidator class ---
@@ -27,15 +32,19 @@ class BillContentValidator {
 class BillValidator {
  public:
   explicit BillValidator(BillConfig config);
+  // 共享只读配置：多个管线（例如每个工作线程一个）共用同一份已编译配置。
+  explicit BillValidator(std::shared_ptr<const BillConfig> config);
 
   // --- MODIFIED: 方法被重构以支持新的两阶段验证流程 ---
   static bool validate_txt_structure(const std::string& bill_content,
                                      ValidationResult& result);
+  static bool validate_txt_structure(const std::vector<std::string_view>& lines,
+                                     ValidationResult& result);
   bool validate_bill_content(const ParsedBill& bill_data,
                              ValidationResult& result);
 
  private:
-  std::unique_ptr<BillConfig> m_config;
+  std::shared_ptr<const BillConfig> m_config;
 };
 
 #endif  // INGEST_VALIDATION_BILLS_VALIDATOR_H_
@@ -5,4 +5,6 @@ export module bill.core.common.text_normalizer;
 
 export namespace bills::core::modules::common_text_normalizer {
 using ::NormalizeBillText;
+using ::SplitBillTextLines;
+using ::ValidateBillText;
 }
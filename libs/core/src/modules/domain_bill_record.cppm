@@ -6,4 +6,7 @@ export module bill.core.domain.bill_record;
 export namespace bills::core::modules::domain_bill_record {
 using ParsedBill = ::ParsedBill;
 using Transaction = ::Transaction;
+using BillVocabulary = ::BillVocabulary;
+using VocabularyId = ::VocabularyId;
+using Money = ::Money;
 }
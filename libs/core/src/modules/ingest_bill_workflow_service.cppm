@@ -4,6 +4,10 @@ module;
 export module bill.core.ingest.bill_workflow_service;
 
 export namespace bills::core::modules::ingest {
+using SourceDocument = ::SourceDocument;
+using SourceDocumentBatch = ::SourceDocumentBatch;
+using SourceDocumentRef = ::SourceDocumentRef;
+using SourceDocumentRefBatch = ::SourceDocumentRefBatch;
 using BillWorkflowFileResult = ::BillWorkflowFileResult;
 using BillWorkflowBatchResult = ::BillWorkflowBatchResult;
 using BillWorkflowService = ::BillWorkflowService;
@@ -1,3 +1,6 @@
+#include <cstddef>
+
+import bill.core.config.bundle_service;
 import bill.core.ingest.bill_workflow_service;
 import bill.core.ingest.bill_processing_pipeline;
 import bill.core.ingest.bill_json_serializer;
@@ -9,9 +12,12 @@ import bill.core.reporting.standard_report_json_serializer;
 import bill.core.record_template.service;
 
 namespace {
+using bills::core::modules::config::RuntimeConfigBundle;
 using bills::core::modules::ingest::BillJsonSerializer;
 using bills::core::modules::ingest::BillProcessingPipeline;
+using bills::core::modules::ingest::BillWorkflowBatchResult;
 using bills::core::modules::ingest::BillWorkflowService;
+using bills::core::modules::ingest::SourceDocumentBatch;
 using bills::core::modules::query::QueryService;
 using bills::core::modules::reporting::ReportRenderService;
 using bills::core::modules::reporting::StandardReportAssembler;
@@ -19,8 +25,13 @@ using bills::core::modules::reporting::StandardReportJsonSerializer;
 using bills::core::modules::reporting::StandardReportRendererRegistry;
 using bills::core::modules::record_template::RecordTemplateService;
 
+// Validate 同时提供持有文本与引用视图两个重载，取地址时需指明签名。
+using WorkflowValidateFn = BillWorkflowBatchResult (*)(
+    const SourceDocumentBatch&, const RuntimeConfigBundle&, std::size_t);
+
 [[maybe_unused]] auto kSerializeEntry = &BillJsonSerializer::serialize;
-[[maybe_unused]] auto kWorkflowValidateEntry = &BillWorkflowService::Validate;
+[[maybe_unused]] WorkflowValidateFn kWorkflowValidateEntry =
+    &BillWorkflowService::Validate;
 [[maybe_unused]] auto kPipelineValidateEntry = &BillProcessingPipeline::validate_content;
 [[maybe_unused]] auto kQueryYearEntry = &QueryService::QueryYear;
 [[maybe_unused]] auto kRenderEntry = &ReportRenderService::Render;
@@ -4,5 +4,6 @@ module;
 export module bill.core.ports.bills_repository;
 
 export namespace bills::core::modules::ports {
+using BillInsertFailure = ::BillInsertFailure;
 using BillRepository = ::BillRepository;
 }
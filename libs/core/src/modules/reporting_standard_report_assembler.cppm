@@ -7,5 +7,6 @@ export namespace bills::core::modules::reporting {
 using StandardReportAssembler = ::StandardReportAssembler;
 using MonthlyReportData = ::MonthlyReportData;
 using MonthlySummary = ::MonthlySummary;
+using RangeReportData = ::RangeReportData;
 using YearlyReportData = ::YearlyReportData;
 }
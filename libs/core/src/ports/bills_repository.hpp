@@ -2,14 +2,39 @@
 #ifndef PORTS_BILLS_REPOSITORY_H_
 #define PORTS_BILLS_REPOSITORY_H_
 
+#include <cstddef>
+#include <exception>
+#include <span>
+#include <string>
+#include <vector>
+
 #include "domain/bill/bill_record.hpp"
 
+// 批量写入中单个账单的失败信息，index 对应 InsertBills 输入中的下标。
+struct BillInsertFailure {
+  std::size_t index = 0;
+  std::string message;
+};
+
 class BillRepository {
  public:
   virtual ~BillRepository() = default;
   virtual void InsertBill(const ParsedBill& bill_data) = 0;
+
+  // 批量写入：单个账单失败不影响其余账单，失败项按输入顺序返回。
+  // 默认实现逐条调用 InsertBill；适配器可覆盖为单连接、单事务写入。
+  virtual auto InsertBills(std::span<const ParsedBill> bills)
+      -> std::vector<BillInsertFailure> {
+    std::vector<BillInsertFailure> failures;
+    for (std::size_t index = 0; index < bills.size(); ++index) {
+      try {
+        InsertBill(bills[index]);
+      } catch (const std::exception& error) {
+        failures.push_back({.index = index, .message = error.what()});
+      }
+    }
+    return failures;
+  }
 };
 
 #endif  // PORTS_BILLS_REPOSITORY_H_
-
-
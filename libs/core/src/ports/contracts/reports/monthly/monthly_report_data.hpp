@@ -3,18 +3,19 @@
 #define PORTS_CONTRACTS_REPORTS_MONTHLY_MONTHLY_REPORT_DATA_H_
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "domain/bill/bill_record.hpp"
 
 struct SubCategoryData {
-  double sub_total = 0.0;
+  Money sub_total;
   std::vector<Transaction> transactions;
 };
 
 struct ParentCategoryData {
-  double parent_total = 0.0;
+  Money parent_total;
   std::map<std::string, SubCategoryData> sub_categories;
 };
 
@@ -25,9 +26,12 @@ struct MonthlyReportData {
   std::map<std::string, ParentCategoryData> aggregated_data;
   bool data_found = false;
 
-  double total_income = 0.0;
-  double total_expense = 0.0;
-  double balance = 0.0;
+  Money total_income;
+  Money total_expense;
+  Money balance;
+
+  // aggregated_data 中交易的分类编号所属的词表。
+  std::shared_ptr<const BillVocabulary> vocabulary;
 };
 
 #endif  // PORTS_CONTRACTS_REPORTS_MONTHLY_MONTHLY_REPORT_DATA_H_
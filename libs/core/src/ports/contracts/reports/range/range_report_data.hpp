@@ -0,0 +1,29 @@
+// ports/contracts/reports/range/range_report_data.hpp
+#ifndef PORTS_CONTRACTS_REPORTS_RANGE_RANGE_REPORT_DATA_H_
+#define PORTS_CONTRACTS_REPORTS_RANGE_RANGE_REPORT_DATA_H_
+
+#include <map>
+#include <string>
+
+#include "ports/contracts/reports/monthly/monthly_report_data.hpp"
+#include "ports/contracts/reports/yearly/yearly_report_data.hpp"
+
+// 跨月区间汇总：只保留按月与按分类的合计，不携带交易明细。
+struct RangeReportData {
+  int start_year = 0;
+  int start_month = 0;
+  int end_year = 0;
+  int end_month = 0;
+  bool data_found = false;
+
+  Money total_income;
+  Money total_expense;
+  Money balance;
+
+  // key 为 YYYY-MM，字典序即时间顺序。
+  std::map<std::string, MonthlySummary> monthly_summary;
+  // sub_categories[].transactions 恒为空。
+  std::map<std::string, ParentCategoryData> aggregated_data;
+};
+
+#endif  // PORTS_CONTRACTS_REPORTS_RANGE_RANGE_REPORT_DATA_H_
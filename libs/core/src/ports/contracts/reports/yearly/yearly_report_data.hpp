@@ -4,18 +4,20 @@
 
 #include <map>
 
+#include "domain/bill/money.hpp"
+
 struct MonthlySummary {
-  double income = 0.0;
-  double expense = 0.0;
+  Money income;
+  Money expense;
 };
 
 struct YearlyReportData {
   int year;
   bool data_found = false;
 
-  double total_income = 0.0;
-  double total_expense = 0.0;
-  double balance = 0.0;
+  Money total_income;
+  Money total_expense;
+  Money balance;
 
   std::map<int, MonthlySummary> monthly_summary;
 };
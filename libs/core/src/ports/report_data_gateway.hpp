@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "ports/contracts/reports/monthly/monthly_report_data.hpp"
+#include "ports/contracts/reports/range/range_report_data.hpp"
 #include "ports/contracts/reports/yearly/yearly_report_data.hpp"
 
 class ReportDataGateway {
@@ -17,6 +18,10 @@ class ReportDataGateway {
       -> MonthlyReportData = 0;
   [[nodiscard]] virtual auto ReadYearlyData(std::string_view iso_year)
       -> YearlyReportData = 0;
+  // 闭区间 [start_iso_month, end_iso_month]，均为 YYYY-MM。
+  [[nodiscard]] virtual auto ReadRangeData(std::string_view start_iso_month,
+                                           std::string_view end_iso_month)
+      -> RangeReportData = 0;
   [[nodiscard]] virtual auto ListAvailableMonths()
       -> std::vector<std::string> = 0;
 };
@@ -24,3 +24,18 @@ auto QueryService::QueryMonth(ReportDataGateway& gateway, std::string_view iso_m
   result.data_found = result.monthly_data.data_found;
   return result;
 }
+
+auto QueryService::QueryRange(ReportDataGateway& gateway,
+                              std::string_view start_iso_month,
+                              std::string_view end_iso_month)
+    -> QueryExecutionResult {
+  QueryExecutionResult result;
+  result.query_type = "range";
+  result.query_value =
+      std::string(start_iso_month) + ".." + std::string(end_iso_month);
+  result.range_data = gateway.ReadRangeData(start_iso_month, end_iso_month);
+  result.year = result.range_data.start_year;
+  result.month = result.range_data.start_month;
+  result.data_found = result.range_data.data_found;
+  return result;
+}
@@ -6,6 +6,7 @@
 
 #include "ports/report_data_gateway.hpp"
 #include "ports/contracts/reports/monthly/monthly_report_data.hpp"
+#include "ports/contracts/reports/range/range_report_data.hpp"
 #include "ports/contracts/reports/yearly/yearly_report_data.hpp"
 
 struct QueryExecutionResult {
@@ -16,6 +17,7 @@ struct QueryExecutionResult {
   bool data_found = false;
   MonthlyReportData monthly_data;
   YearlyReportData yearly_data;
+  RangeReportData range_data;
 };
 
 class QueryService {
@@ -27,6 +29,12 @@ class QueryService {
   [[nodiscard]] static auto QueryMonth(ReportDataGateway& gateway,
                                        std::string_view iso_month)
       -> QueryExecutionResult;
+
+  // query_value 为 "YYYY-MM..YYYY-MM"；year/month 取区间起点。
+  [[nodiscard]] static auto QueryRange(ReportDataGateway& gateway,
+                                       std::string_view start_iso_month,
+                                       std::string_view end_iso_month)
+      -> QueryExecutionResult;
 };
 
 #endif  // QUERY_QUERY_SERVICE_HPP_
@@ -107,9 +107,9 @@ auto RecordTemplateService::ValidateRecordBatch(
       preview_file.year = bill_data.year;
       preview_file.month = bill_data.month;
       preview_file.transaction_count = bill_data.transactions.size();
-      preview_file.total_income = bill_data.total_income;
-      preview_file.total_expense = bill_data.total_expense;
-      preview_file.balance = bill_data.balance;
+      preview_file.total_income = bill_data.total_income.ToDouble();
+      preview_file.total_expense = bill_data.total_expense.ToDouble();
+      preview_file.balance = bill_data.balance.ToDouble();
       ++preview_result.success;
       periods.insert(preview_file.period);
     } catch (const std::exception& error) {
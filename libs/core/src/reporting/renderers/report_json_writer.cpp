@@ -0,0 +1,260 @@
+// reporting/renderers/report_json_writer.cpp
+#include "report_json_writer.hpp"
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+#include "nlohmann/json.hpp"
+
+namespace {
+
+constexpr std::size_t kIndentWidth = 2U;
+constexpr std::string_view kIndentSpaces = "                                ";
+// 与 nlohmann::json 序列化器的数字缓冲区同宽。
+constexpr std::size_t kNumberBufferSize = 64U;
+
+// 返回 text[index] 起始的合法 UTF-8 序列长度；非法序列（含过长编码、代理区、
+// 超出 U+10FFFF）返回 0。
+auto Utf8SequenceLength(std::string_view text, std::size_t index)
+    -> std::size_t {
+  const auto byte_at = [&](std::size_t offset) -> unsigned char {
+    return static_cast<unsigned char>(text[index + offset]);
+  };
+  const unsigned char lead = byte_at(0U);
+  std::size_t length = 0U;
+  unsigned char second_min = 0x80U;
+  unsigned char second_max = 0xBFU;
+  if (lead >= 0xC2U && lead <= 0xDFU) {
+    length = 2U;
+  } else if (lead >= 0xE0U && lead <= 0xEFU) {
+    length = 3U;
+    if (lead == 0xE0U) {
+      second_min = 0xA0U;
+    } else if (lead == 0xEDU) {
+      second_max = 0x9FU;
+    }
+  } else if (lead >= 0xF0U && lead <= 0xF4U) {
+    length = 4U;
+    if (lead == 0xF0U) {
+      second_min = 0x90U;
+    } else if (lead == 0xF4U) {
+      second_max = 0x8FU;
+    }
+  } else {
+    return 0U;
+  }
+
+  if (text.size() - index < length) {
+    return 0U;
+  }
+  if (byte_at(1U) < second_min || byte_at(1U) > second_max) {
+    return 0U;
+  }
+  for (std::size_t offset = 2U; offset < length; ++offset) {
+    if (byte_at(offset) < 0x80U || byte_at(offset) > 0xBFU) {
+      return 0U;
+    }
+  }
+  return length;
+}
+
+// nlohmann::detail::to_chars 不属于公开 API，全库只经由此处调用。版本钉在已逐字节
+// 核对过 dump() 数字格式的 3.11.x；升级 nlohmann_json 时需重新核对后再放宽断言。
+static_assert(NLOHMANN_JSON_VERSION_MAJOR == 3 &&
+                  NLOHMANN_JSON_VERSION_MINOR == 11,
+              "ReportJsonWriter relies on nlohmann::detail::to_chars from "
+              "nlohmann_json 3.11.x; re-verify number formatting before "
+              "upgrading.");
+
+auto NlohmannDoubleToChars(char* first, char* last, double value) -> char* {
+  return nlohmann::detail::to_chars(first, last, value);
+}
+
+// 直接复用 nlohmann::json 序列化浮点数所用的 Grisu2 实现：它并不总是产出最短
+// 表示，换用 std::to_chars 会在少数取值上与 dump() 的结果不同。
+auto FormatNumber(double value, std::array<char, kNumberBufferSize>& buffer)
+    -> std::string_view {
+  if (!std::isfinite(value)) {
+    return "null";
+  }
+  const char* end = NlohmannDoubleToChars(
+      buffer.data(), buffer.data() + buffer.size(), value);
+  return {buffer.data(), static_cast<std::size_t>(end - buffer.data())};
+}
+
+}  // namespace
+
+ReportJsonWriter::ReportJsonWriter(ReportOutputSink& sink) : output_(sink) {}
+
+void ReportJsonWriter::BeginObject() { BeginContainer(true, '{'); }
+
+void ReportJsonWriter::EndObject() { EndContainer(true, '}'); }
+
+void ReportJsonWriter::BeginArray() { BeginContainer(false, '['); }
+
+void ReportJsonWriter::EndArray() { EndContainer(false, ']'); }
+
+void ReportJsonWriter::Key(std::string_view key) {
+  if (frames_.empty() || !frames_.back().is_object || pending_key_) {
+    throw std::logic_error("ReportJsonWriter: key written outside an object.");
+  }
+  Frame& frame = frames_.back();
+  if (frame.count > 0U) {
+    output_ << ',';
+  }
+  ++frame.count;
+  WriteNewlineAndIndent();
+  WriteEscaped(key);
+  output_ << ": ";
+  pending_key_ = true;
+}
+
+void ReportJsonWriter::String(std::string_view value) {
+  BeginValue();
+  WriteEscaped(value);
+}
+
+void ReportJsonWriter::Number(double value) {
+  BeginValue();
+  std::array<char, kNumberBufferSize> buffer{};
+  output_ << FormatNumber(value, buffer);
+}
+
+void ReportJsonWriter::Integer(int value) {
+  BeginValue();
+  output_ << value;
+}
+
+void ReportJsonWriter::Bool(bool value) {
+  BeginValue();
+  output_ << (value ? "true" : "false");
+}
+
+void ReportJsonWriter::StringField(std::string_view key,
+                                   std::string_view value) {
+  Key(key);
+  String(value);
+}
+
+void ReportJsonWriter::NumberField(std::string_view key, double value) {
+  Key(key);
+  Number(value);
+}
+
+void ReportJsonWriter::IntegerField(std::string_view key, int value) {
+  Key(key);
+  Integer(value);
+}
+
+void ReportJsonWriter::BoolField(std::string_view key, bool value) {
+  Key(key);
+  Bool(value);
+}
+
+void ReportJsonWriter::Flush() { output_.Flush(); }
+
+void ReportJsonWriter::BeginValue() {
+  if (pending_key_) {
+    pending_key_ = false;
+    return;
+  }
+  if (frames_.empty()) {
+    return;
+  }
+  Frame& frame = frames_.back();
+  if (frame.is_object) {
+    throw std::logic_error("ReportJsonWriter: object member without a key.");
+  }
+  if (frame.count > 0U) {
+    output_ << ',';
+  }
+  ++frame.count;
+  WriteNewlineAndIndent();
+}
+
+void ReportJsonWriter::BeginContainer(bool is_object, char open) {
+  BeginValue();
+  output_ << open;
+  frames_.push_back(Frame{.is_object = is_object});
+}
+
+void ReportJsonWriter::EndContainer(bool is_object, char close) {
+  if (frames_.empty() || frames_.back().is_object != is_object ||
+      pending_key_) {
+    throw std::logic_error("ReportJsonWriter: unbalanced container end.");
+  }
+  const bool has_members = frames_.back().count > 0U;
+  frames_.pop_back();
+  if (has_members) {
+    WriteNewlineAndIndent();
+  }
+  output_ << close;
+}
+
+void ReportJsonWriter::WriteNewlineAndIndent() {
+  output_ << '\n';
+  std::size_t remaining = frames_.size() * kIndentWidth;
+  while (remaining > 0U) {
+    const std::size_t step = remaining < kIndentSpaces.size()
+                                 ? remaining
+                                 : kIndentSpaces.size();
+    output_ << kIndentSpaces.substr(0U, step);
+    remaining -= step;
+  }
+}
+
+void ReportJsonWriter::WriteEscaped(std::string_view text) {
+  static constexpr std::string_view kHexDigits = "0123456789abcdef";
+  output_ << '"';
+  std::size_t run_start = 0U;
+  std::size_t index = 0U;
+  while (index < text.size()) {
+    const auto byte = static_cast<unsigned char>(text[index]);
+    if (byte >= 0x80U) {
+      const std::size_t length = Utf8SequenceLength(text, index);
+      if (length == 0U) {
+        throw std::runtime_error("Invalid UTF-8 byte in report JSON string.");
+      }
+      index += length;
+      continue;
+    }
+    if (byte >= 0x20U && byte != '"' && byte != '\\') {
+      ++index;
+      continue;
+    }
+
+    // 未转义的连续片段整段写出，只在需要转义的字节处断开。
+    output_ << text.substr(run_start, index - run_start);
+    switch (byte) {
+      case '"':
+        output_ << "\\\"";
+        break;
+      case '\\':
+        output_ << "\\\\";
+        break;
+      case '\b':
+        output_ << "\\b";
+        break;
+      case '\t':
+        output_ << "\\t";
+        break;
+      case '\n':
+        output_ << "\\n";
+        break;
+      case '\f':
+        output_ << "\\f";
+        break;
+      case '\r':
+        output_ << "\\r";
+        break;
+      default:
+        output_ << "\\u00" << kHexDigits[byte >> 4U] << kHexDigits[byte & 0x0FU];
+        break;
+    }
+    ++index;
+    run_start = index;
+  }
+  output_ << text.substr(run_start, index - run_start);
+  output_ << '"';
+}
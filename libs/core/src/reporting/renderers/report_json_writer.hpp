@@ -0,0 +1,64 @@
+// reporting/renderers/report_json_writer.hpp
+#ifndef REPORTING_RENDERERS_REPORT_JSON_WRITER_H_
+#define REPORTING_RENDERERS_REPORT_JSON_WRITER_H_
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "report_output_sink.hpp"
+
+/**
+ * @class ReportJsonWriter
+ * @brief 流式 JSON 写入器：按调用顺序直接输出文本，不构建中间 DOM。
+ *
+ * 输出格式与 nlohmann::json::dump(2) 逐字节一致：两空格缩进、"key": value、
+ * 空对象/空数组写作 {} / []；浮点数沿用 nlohmann 的 Grisu2 格式化（整数值保留
+ * ".0"），非有限值写作 null；字符串按 UTF-8 原样输出，仅转义引号、反斜杠与
+ * 控制字符，非法 UTF-8 抛出 std::runtime_error。写完后必须调用 Flush()。
+ */
+class ReportJsonWriter {
+ public:
+  explicit ReportJsonWriter(ReportOutputSink& sink);
+
+  ReportJsonWriter(const ReportJsonWriter&) = delete;
+  auto operator=(const ReportJsonWriter&) -> ReportJsonWriter& = delete;
+
+  void BeginObject();
+  void EndObject();
+  void BeginArray();
+  void EndArray();
+
+  // 对象成员名；紧随其后的一次值写入（含 Begin*）即该成员的值。
+  void Key(std::string_view key);
+
+  void String(std::string_view value);
+  void Number(double value);
+  void Integer(int value);
+  void Bool(bool value);
+
+  void StringField(std::string_view key, std::string_view value);
+  void NumberField(std::string_view key, double value);
+  void IntegerField(std::string_view key, int value);
+  void BoolField(std::string_view key, bool value);
+
+  void Flush();
+
+ private:
+  struct Frame {
+    bool is_object = false;
+    std::size_t count = 0U;
+  };
+
+  void BeginValue();
+  void BeginContainer(bool is_object, char open);
+  void EndContainer(bool is_object, char close);
+  void WriteNewlineAndIndent();
+  void WriteEscaped(std::string_view text);
+
+  ReportTextWriter output_;
+  std::vector<Frame> frames_;
+  bool pending_key_ = false;
+};
+
+#endif  // REPORTING_RENDERERS_REPORT_JSON_WRITER_H_
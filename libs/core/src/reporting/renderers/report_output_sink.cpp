@@ -0,0 +1,76 @@
+// reporting/renderers/report_output_sink.cpp
+#include "report_output_sink.hpp"
+
+#include <array>
+#include <charconv>
+#include <system_error>
+
+namespace {
+
+constexpr int kAmountPrecision = 2;
+// 足以容纳 DBL_MAX 以 fixed 格式输出的全部整数位、符号与两位小数。
+constexpr std::size_t kNumberBufferSize = 320U;
+
+}  // namespace
+
+ReportTextWriter::ReportTextWriter(ReportOutputSink& sink) : sink_(sink) {
+  buffer_.reserve(kChunkSize);
+}
+
+auto ReportTextWriter::operator<<(std::string_view text) -> ReportTextWriter& {
+  if (buffer_.size() + text.size() > kChunkSize && !buffer_.empty()) {
+    Flush();
+  }
+  // 超过一整块的长文本不再经过缓冲区，直接交给 sink。
+  if (text.size() >= kChunkSize) {
+    sink_.Write(text);
+    return *this;
+  }
+  buffer_.append(text);
+  FlushIfFull();
+  return *this;
+}
+
+auto ReportTextWriter::operator<<(char ch) -> ReportTextWriter& {
+  buffer_.push_back(ch);
+  FlushIfFull();
+  return *this;
+}
+
+auto ReportTextWriter::operator<<(int value) -> ReportTextWriter& {
+  std::array<char, 16U> buffer{};
+  const auto [end, error] =
+      std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  return *this << std::string_view(
+             buffer.data(), error == std::errc{} ? end : buffer.data());
+}
+
+auto ReportTextWriter::operator<<(double value) -> ReportTextWriter& {
+  std::array<char, kNumberBufferSize> buffer{};
+  const auto [end, error] =
+      std::to_chars(buffer.data(), buffer.data() + buffer.size(), value,
+                    std::chars_format::fixed, kAmountPrecision);
+  return *this << std::string_view(
+             buffer.data(), error == std::errc{} ? end : buffer.data());
+}
+
+auto ReportTextWriter::operator<<(ZeroPadded2 value) -> ReportTextWriter& {
+  if (value.value >= 0 && value.value < 10) {
+    *this << '0';
+  }
+  return *this << value.value;
+}
+
+void ReportTextWriter::Flush() {
+  if (buffer_.empty()) {
+    return;
+  }
+  sink_.Write(buffer_);
+  buffer_.clear();
+}
+
+void ReportTextWriter::FlushIfFull() {
+  if (buffer_.size() >= kChunkSize) {
+    Flush();
+  }
+}
@@ -0,0 +1,64 @@
+// reporting/renderers/report_output_sink.hpp
+#ifndef REPORTING_RENDERERS_REPORT_OUTPUT_SINK_H_
+#define REPORTING_RENDERERS_REPORT_OUTPUT_SINK_H_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// 渲染输出目标：渲染器按块追加文本，由调用方决定落到内存、文件还是其他地方。
+class ReportOutputSink {
+ public:
+  virtual ~ReportOutputSink() = default;
+  virtual void Write(std::string_view chunk) = 0;
+};
+
+// 追加到调用方持有的字符串，供需要完整文本的场景（终端展示、ABI 返回值）使用。
+class StringReportOutputSink final : public ReportOutputSink {
+ public:
+  explicit StringReportOutputSink(std::string& output) : output_(output) {}
+
+  void Write(std::string_view chunk) override { output_.append(chunk); }
+
+ private:
+  std::string& output_;
+};
+
+// 两位补零的整数，对应流输出中的 std::setw(2) << std::setfill('0')。
+struct ZeroPadded2 {
+  int value = 0;
+};
+
+/**
+ * @class ReportTextWriter
+ * @brief 渲染器使用的分块写入器：文本先攒进固定大小的缓冲区，满后整块交给 sink。
+ *
+ * 浮点数固定按两位小数经 std::to_chars 格式化，结果与
+ * std::fixed << std::setprecision(2) 的流输出逐字节一致，但不经过 iostream。
+ * 渲染结束时必须调用 Flush()，把最后一块交给 sink。
+ */
+class ReportTextWriter {
+ public:
+  explicit ReportTextWriter(ReportOutputSink& sink);
+
+  ReportTextWriter(const ReportTextWriter&) = delete;
+  auto operator=(const ReportTextWriter&) -> ReportTextWriter& = delete;
+
+  auto operator<<(std::string_view text) -> ReportTextWriter&;
+  auto operator<<(char ch) -> ReportTextWriter&;
+  auto operator<<(int value) -> ReportTextWriter&;
+  auto operator<<(double value) -> ReportTextWriter&;
+  auto operator<<(ZeroPadded2 value) -> ReportTextWriter&;
+
+  void Flush();
+
+ private:
+  static constexpr std::size_t kChunkSize = 16U * 1024U;
+
+  void FlushIfFull();
+
+  ReportOutputSink& sink_;
+  std::string buffer_;
+};
+
+#endif  // REPORTING_RENDERERS_REPORT_OUTPUT_SINK_H_
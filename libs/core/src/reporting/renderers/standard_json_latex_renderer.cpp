@@ -1,13 +1,11 @@
 #include "standard_json_latex_renderer.hpp"
 
-#include <algorithm>
 #include <cmath>
-#include <iomanip>
-#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
+#include "report_output_sink.hpp"
 #include "reporting/standard_report/standard_report_json_serializer.hpp"
 #include "standard_report_render_support.hpp"
 
@@ -57,41 +55,19 @@ auto escape_latex(const std::string& input) -> std::string {
   return output;
 }
 
-auto sorted_monthly_categories(const StandardReport& report)
-    -> std::vector<StandardCategoryItem> {
-  auto categories = report.categories;
-  for (auto& category : categories) {
-    for (auto& sub_category : category.sub_categories) {
-      std::ranges::sort(sub_category.transactions,
-                        [](const StandardTransactionItem& left,
-                           const StandardTransactionItem& right) -> bool {
-                          return left.amount > right.amount;
-                        });
-    }
-  }
-  std::ranges::sort(categories, [](const StandardCategoryItem& left,
-                                   const StandardCategoryItem& right) -> bool {
-    return left.total > right.total;
-  });
-  return categories;
-}
-
-auto render_monthly_remark(const std::string& remark) -> std::string {
+void render_monthly_remark(const std::string& remark, ReportTextWriter& output) {
   const auto lines = render_support::SplitRemarkLinesOrDash(remark);
-  std::ostringstream output;
   output << escape_latex(lines.front());
   for (std::size_t index = 1U; index < lines.size(); ++index) {
     output << "\\\\\n    " << escape_latex(lines[index]);
   }
-  return output.str();
 }
 
-auto render_monthly(const StandardReport& report) -> std::string {
+void render_monthly(const StandardReport& report, ReportTextWriter& output) {
   const std::string period_label =
       render_support::FormatMonthlyPeriodLabel(report.period_start);
 
   if (!report.data_found) {
-    std::ostringstream output;
     output << "\\documentclass[12pt]{article}\n";
     output << "\\usepackage{fontspec}\n";
     output << "\\usepackage[nofonts]{ctex}\n";
@@ -100,13 +76,11 @@ auto render_monthly(const StandardReport& report) -> std::string {
     output << "\\begin{document}\n";
     output << "未找到 " << period_label << " 的任何数据。\n";
     output << "\\end{document}\n";
-    return output.str();
+    return;
   }
 
-  const auto categories = sorted_monthly_categories(report);
+  const auto categories = render_support::SortCategoriesByTotal(report);
 
-  std::ostringstream output;
-  output << std::fixed << std::setprecision(2);
   output << "\\documentclass[12pt]{article}\n";
   output << "\\usepackage[a4paper, margin=1in]{geometry}\n";
   output << "\\usepackage{fontspec}\n";
@@ -133,13 +107,15 @@ auto render_monthly(const StandardReport& report) -> std::string {
   output << "    \\textbf{收入：} CNY" << report.total_income << "\\\\\n";
   output << "    \\textbf{支出：} CNY" << report.total_expense << "\\\\\n";
   output << "    \\textbf{结余：} CNY" << report.balance << "\\\\\n";
-  output << "    \\textbf{备注：} " << render_monthly_remark(report.remark)
-         << "\n";
+  output << "    \\textbf{备注：} ";
+  render_monthly_remark(report.remark, output);
+  output << "\n";
   output << "    }\n";
   output << "\\end{center}\n";
   output << "\\hrulefill\n\n";
 
-  for (const auto& category : categories) {
+  for (const auto& category_view : categories) {
+    const auto& category = *category_view.category;
     const double parent_pct =
         (report.total_expense != 0.0)
             ? std::abs(category.total / report.total_expense * 100.0)
@@ -147,7 +123,8 @@ auto render_monthly(const StandardReport& report) -> std::string {
     output << "\\section*{" << escape_latex(category.name) << "}\n";
     output << "总计：CNY" << category.total << " \t (占总支出: " << parent_pct
            << "\\%)\n\n";
-    for (const auto& sub : category.sub_categories) {
+    for (const auto& sub_view : category_view.sub_categories) {
+      const auto& sub = *sub_view.sub_category;
       const double sub_pct = (category.total != 0.0)
                                  ? std::abs(sub.subtotal / category.total * 100.0)
                                  : 0.0;
@@ -155,35 +132,29 @@ auto render_monthly(const StandardReport& report) -> std::string {
       output << "\\textbf{小计：} CNY" << sub.subtotal << " (占该类: " << sub_pct
              << "\\%)\n";
       output << "\\begin{itemize}\n";
-      for (const auto& tx : sub.transactions) {
-        output << "    \\item CNY" << tx.amount << " --- "
-               << escape_latex(tx.description) << "\n";
+      for (const auto* tx : sub_view.transactions) {
+        output << "    \\item CNY" << tx->amount << " --- "
+               << escape_latex(tx->description) << "\n";
       }
       output << "\\end{itemize}\n";
     }
   }
 
   output << "\\end{document}\n";
-  return output.str();
 }
 
-auto render_yearly(const StandardReport& report) -> std::string {
+void render_yearly(const StandardReport& report, ReportTextWriter& output) {
   const std::string year_text =
       (report.period_start.size() >= 4U) ? report.period_start.substr(0U, 4U)
                                          : "0000";
 
   if (!report.data_found) {
-    return "未找到 " + year_text + " 年的任何数据。\n";
+    output << "未找到 " << year_text << " 年的任何数据。\n";
+    return;
   }
 
-  auto months = report.monthly_summary;
-  std::ranges::sort(months, [](const StandardMonthlySummaryItem& left,
-                               const StandardMonthlySummaryItem& right) -> bool {
-    return left.month < right.month;
-  });
+  const auto months = render_support::SortMonthsAscending(report);
 
-  std::ostringstream output;
-  output << std::fixed << std::setprecision(2);
   output << "\\documentclass[12pt]{article}\n";
   output << "\\usepackage{fontspec}\n";
   output << "\\usepackage[nofonts]{ctex}\n";
@@ -211,31 +182,109 @@ auto render_yearly(const StandardReport& report) -> std::string {
   output << "\\textbf{月份} & \\textbf{收入} & \\textbf{支出} & "
             "\\textbf{结余} \\\\\n";
   output << "\\hline\n";
-  for (const auto& item : months) {
-    output << year_text << "-" << std::setw(2) << std::setfill('0') << item.month
-           << " & CNY " << item.income << " & CNY " << item.expense
-           << " & CNY " << (item.income + item.expense) << " \\\\\n";
+  for (const auto* item : months) {
+    output << year_text << "-" << ZeroPadded2{item->month} << " & CNY "
+           << item->income << " & CNY " << item->expense << " & CNY "
+           << (item->income + item->expense) << " \\\\\n";
     output << "\\hline\n";
   }
   output << "\\end{tabular}\n";
   output << "\\end{table}\n";
   output << "\\end{document}\n";
+}
+
+void render_range(const StandardReport& report, ReportTextWriter& output) {
+  const std::string title =
+      render_support::RangeTitleText(report.period_start, report.period_end);
+
+  if (!report.data_found) {
+    output << "未找到 "
+           << render_support::FormatMonthlyPeriodLabel(report.period_start)
+           << " 至 " << render_support::FormatMonthlyPeriodLabel(report.period_end)
+           << " 的任何数据。\n";
+    return;
+  }
+
+  const auto categories = render_support::SortCategoriesByTotal(report);
+
+  output << "\\documentclass[12pt]{article}\n";
+  output << "\\usepackage{fontspec}\n";
+  output << "\\usepackage[nofonts]{ctex}\n";
+  output << "\\usepackage{longtable}\n";
+  output << "\\usepackage[a4paper, margin=1in]{geometry}\n\n";
+  output << "% --- Font Settings from Config ---\n";
+  output << "\\setmainfont{Noto Serif SC}\n";
+  output << "\\setCJKmainfont{Noto Serif SC}\n\n";
+  output << "\\title{" << escape_latex(title) << "}\n";
+  output << "\\author{BillsMaster}\n";
+  output << "\\date{\\today}\n\n";
+  output << "\\begin{document}\n";
+  output << "\\maketitle\n\n";
+  output << "\\section*{区间总览}\n";
+  output << "\\begin{itemize}\n";
+  output << "    \\item \\textbf{区间总收入:} CNY" << report.total_income << "\n";
+  output << "    \\item \\textbf{区间总支出:} CNY" << report.total_expense << "\n";
+  output << "    \\item \\textbf{区间结余:} CNY" << report.balance << "\n";
+  output << "\\end{itemize}\n\n";
 
-  return output.str();
+  // 区间可能跨越数十个月，使用 longtable 允许跨页。
+  output << "\\section*{每月明细}\n";
+  output << "\\begin{longtable}{|c|c|c|c|}\n";
+  output << "\\hline\n";
+  output << "\\textbf{月份} & \\textbf{收入} & \\textbf{支出} & "
+            "\\textbf{结余} \\\\\n";
+  output << "\\hline\n";
+  for (const auto& item : report.monthly_summary) {
+    output << render_support::RangeMonthLabel(item.year, item.month)
+           << " & CNY " << item.income << " & CNY " << item.expense
+           << " & CNY " << item.balance << " \\\\\n";
+    output << "\\hline\n";
+  }
+  output << "\\end{longtable}\n\n";
+
+  output << "\\section*{分类合计}\n";
+  for (const auto& category_view : categories) {
+    const auto& category = *category_view.category;
+    const double parent_pct =
+        (report.total_expense != 0.0)
+            ? std::abs(category.total / report.total_expense * 100.0)
+            : 0.0;
+    output << "\\subsection*{" << escape_latex(category.name) << "}\n";
+    output << "总计：CNY" << category.total << " \t (占总支出: " << parent_pct
+           << "\\%)\n";
+    output << "\\begin{itemize}\n";
+    for (const auto& sub : category.sub_categories) {
+      output << "    \\item " << escape_latex(sub.name) << "：CNY" << sub.subtotal
+             << "\n";
+    }
+    output << "\\end{itemize}\n";
+  }
+  output << "\\end{document}\n";
 }
 
 }  // namespace
 
 auto StandardJsonLatexRenderer::render(const StandardReport& standard_report)
     -> std::string {
+  std::string output;
+  StringReportOutputSink sink(output);
+  render_to(standard_report, sink);
+  return output;
+}
+
+void StandardJsonLatexRenderer::render_to(const StandardReport& standard_report,
+                                          ReportOutputSink& sink) {
+  ReportTextWriter output(sink);
   if (standard_report.report_type == "monthly") {
-    return render_monthly(standard_report);
-  }
-  if (standard_report.report_type == "yearly") {
-    return render_yearly(standard_report);
+    render_monthly(standard_report, output);
+  } else if (standard_report.report_type == "yearly") {
+    render_yearly(standard_report, output);
+  } else if (standard_report.report_type == "range") {
+    render_range(standard_report, output);
+  } else {
+    throw std::runtime_error("Unsupported report_type in standard report JSON.");
   }
-
-  throw std::runtime_error("Unsupported report_type in standard report JSON.");
+  output.Flush();
 }
 
 auto StandardJsonLatexRenderer::render(const std::string& standard_report_json)
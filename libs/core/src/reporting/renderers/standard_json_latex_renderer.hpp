@@ -4,12 +4,15 @@
 
 #include <string>
 
+class ReportOutputSink;
 struct StandardReport;
 
 class StandardJsonLatexRenderer {
  public:
   static auto render(const StandardReport& standard_report) -> std::string;
   static auto render(const std::string& standard_report_json) -> std::string;
+  static void render_to(const StandardReport& standard_report,
+                        ReportOutputSink& sink);
 };
 
 #endif  // REPORTS_CORE_STANDARD_JSON_LATEX_RENDERER_H_
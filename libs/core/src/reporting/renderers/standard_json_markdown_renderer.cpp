@@ -1,69 +1,47 @@
 // reporting/renderers/standard_json_markdown_renderer.cpp
 #include "standard_json_markdown_renderer.hpp"
 
-#include <algorithm>
 #include <cmath>
-#include <iomanip>
-#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
+#include "report_output_sink.hpp"
 #include "reporting/standard_report/standard_report_json_serializer.hpp"
 #include "standard_report_render_support.hpp"
 
 namespace {
 namespace render_support = bills::core::reporting::render_support;
 
-auto SortedMonthlyCategories(const StandardReport& report)
-    -> std::vector<StandardCategoryItem> {
-  auto categories = report.categories;
-  for (auto& category : categories) {
-    for (auto& sub_category : category.sub_categories) {
-      std::ranges::sort(sub_category.transactions,
-                        [](const StandardTransactionItem& left,
-                           const StandardTransactionItem& right) -> bool {
-                          return left.amount > right.amount;
-                        });
-    }
-  }
-  std::ranges::sort(categories, [](const StandardCategoryItem& left,
-                                   const StandardCategoryItem& right) -> bool {
-    return left.total > right.total;
-  });
-  return categories;
-}
-
-auto RenderMonthlyRemark(const std::string& remark) -> std::string {
+void RenderMonthlyRemark(const std::string& remark, ReportTextWriter& output) {
   const auto lines = render_support::SplitRemarkLinesOrDash(remark);
-  std::ostringstream output;
   output << "- 备注: " << lines.front();
   for (std::size_t index = 1U; index < lines.size(); ++index) {
     output << "\n  " << lines[index];
   }
-  return output.str();
 }
 
-auto RenderMonthly(const StandardReport& report) -> std::string {
+void RenderMonthly(const StandardReport& report, ReportTextWriter& output) {
   const std::string kPeriodLabel =
       render_support::FormatMonthlyPeriodLabel(report.period_start);
 
   if (!report.data_found) {
-    return "未找到 " + kPeriodLabel + " 的账单记录。";
+    output << "未找到 " << kPeriodLabel << " 的账单记录。";
+    return;
   }
-  const auto categories = SortedMonthlyCategories(report);
+  const auto categories = render_support::SortCategoriesByTotal(report);
 
-  std::ostringstream output;
-  output << std::fixed << std::setprecision(2);
   output << "\n# " << render_support::MonthlyTitleText(report.period_start)
          << "\n";
   output << "\n## 总览\n";
   output << "- 收入: CNY" << report.total_income << "\n";
   output << "- 支出: CNY" << report.total_expense << "\n";
   output << "- 结余: CNY" << report.balance << "\n";
-  output << RenderMonthlyRemark(report.remark) << "\n";
+  RenderMonthlyRemark(report.remark, output);
+  output << "\n";
 
-  for (const auto& category : categories) {
+  for (const auto& category_view : categories) {
+    const auto& category = *category_view.category;
     const double kParentPct =
         (report.total_expense != 0.0)
             ? std::abs(category.total / report.total_expense * 100.0)
@@ -72,38 +50,33 @@ auto RenderMonthly(const StandardReport& report) -> std::string {
     output << "总计:CNY" << category.total << "\n";
     output << "占比:" << kParentPct << "%\n";
 
-    for (const auto& sub : category.sub_categories) {
+    for (const auto& sub_view : category_view.sub_categories) {
+      const auto& sub = *sub_view.sub_category;
       const double kSubPct =
           (category.total != 0.0) ? std::abs(sub.subtotal / category.total * 100.0)
                                   : 0.0;
       output << "\n### " << sub.name << "\n";
       output << "小计:CNY" << sub.subtotal << "(占比:" << kSubPct << "%)\n";
-      for (const auto& transaction : sub.transactions) {
-        output << "- CNY" << transaction.amount << " "
-               << transaction.description << "\n";
+      for (const auto* transaction : sub_view.transactions) {
+        output << "- CNY" << transaction->amount << " "
+               << transaction->description << "\n";
       }
     }
   }
-  return output.str();
 }
 
-auto RenderYearly(const StandardReport& report) -> std::string {
+void RenderYearly(const StandardReport& report, ReportTextWriter& output) {
   const std::string kYearStr =
       (report.period_start.size() >= 4U) ? report.period_start.substr(0U, 4U)
                                          : "0000";
 
   if (!report.data_found) {
-    return "未找到 " + kYearStr + " 年的账单记录。";
+    output << "未找到 " << kYearStr << " 年的账单记录。";
+    return;
   }
 
-  auto months = report.monthly_summary;
-  std::ranges::sort(months, [](const StandardMonthlySummaryItem& left,
-                               const StandardMonthlySummaryItem& right) -> bool {
-    return left.month < right.month;
-  });
+  const auto months = render_support::SortMonthsAscending(report);
 
-  std::ostringstream output;
-  output << std::fixed << std::setprecision(2);
   output << "\n## " << kYearStr << "年 总览\n";
   output << "- **年总收入:** " << report.total_income << " CNY\n";
   output << "- **年总支出:** " << report.total_expense << " CNY\n";
@@ -111,28 +84,79 @@ auto RenderYearly(const StandardReport& report) -> std::string {
   output << "\n## 每月明细\n\n";
   output << "| 月份 | 收入 (CNY) | 支出 (CNY) | 结余 (CNY) |\n";
   output << "| :--- | :--- | :--- | :--- |\n";
-  for (const auto& month_item : months) {
-    output << "| " << kYearStr << "-" << std::setw(2) << std::setfill('0')
-           << month_item.month << " | " << month_item.income << " | "
-           << month_item.expense << " | "
-           << (month_item.income + month_item.expense) << " |\n";
+  for (const auto* month_item : months) {
+    output << "| " << kYearStr << "-" << ZeroPadded2{month_item->month} << " | "
+           << month_item->income << " | " << month_item->expense << " | "
+           << (month_item->income + month_item->expense) << " |\n";
+  }
+}
+
+void RenderRange(const StandardReport& report, ReportTextWriter& output) {
+  const std::string kTitle =
+      render_support::RangeTitleText(report.period_start, report.period_end);
+
+  if (!report.data_found) {
+    output << "未找到 "
+           << render_support::FormatMonthlyPeriodLabel(report.period_start)
+           << " 至 " << render_support::FormatMonthlyPeriodLabel(report.period_end)
+           << " 的账单记录。";
+    return;
   }
+  const auto categories = render_support::SortCategoriesByTotal(report);
 
-  return output.str();
+  output << "\n# " << kTitle << "\n";
+  output << "\n## 总览\n";
+  output << "- **区间总收入:** " << report.total_income << " CNY\n";
+  output << "- **区间总支出:** " << report.total_expense << " CNY\n";
+  output << "- **区间结余:** " << report.balance << " CNY\n";
+  output << "\n## 每月明细\n\n";
+  output << "| 月份 | 收入 (CNY) | 支出 (CNY) | 结余 (CNY) |\n";
+  output << "| :--- | :--- | :--- | :--- |\n";
+  for (const auto& month_item : report.monthly_summary) {
+    output << "| "
+           << render_support::RangeMonthLabel(month_item.year, month_item.month)
+           << " | " << month_item.income << " | " << month_item.expense << " | "
+           << month_item.balance << " |\n";
+  }
+
+  output << "\n## 分类合计\n";
+  for (const auto& category_view : categories) {
+    const auto& category = *category_view.category;
+    const double kParentPct =
+        (report.total_expense != 0.0)
+            ? std::abs(category.total / report.total_expense * 100.0)
+            : 0.0;
+    output << "\n### " << category.name << "\n";
+    output << "总计:CNY" << category.total << "(占比:" << kParentPct << "%)\n";
+    for (const auto& sub : category.sub_categories) {
+      output << "- " << sub.name << ": CNY" << sub.subtotal << "\n";
+    }
+  }
 }
 
 }  // namespace
 
 auto StandardJsonMarkdownRenderer::render(const StandardReport& standard_report)
     -> std::string {
+  std::string output;
+  StringReportOutputSink sink(output);
+  render_to(standard_report, sink);
+  return output;
+}
+
+void StandardJsonMarkdownRenderer::render_to(const StandardReport& standard_report,
+                                             ReportOutputSink& sink) {
+  ReportTextWriter output(sink);
   if (standard_report.report_type == "monthly") {
-    return RenderMonthly(standard_report);
-  }
-  if (standard_report.report_type == "yearly") {
-    return RenderYearly(standard_report);
+    RenderMonthly(standard_report, output);
+  } else if (standard_report.report_type == "yearly") {
+    RenderYearly(standard_report, output);
+  } else if (standard_report.report_type == "range") {
+    RenderRange(standard_report, output);
+  } else {
+    throw std::runtime_error("Unsupported report_type in standard report JSON.");
   }
-
-  throw std::runtime_error("Unsupported report_type in standard report JSON.");
+  output.Flush();
 }
 
 auto StandardJsonMarkdownRenderer::render(const std::string& standard_report_json)
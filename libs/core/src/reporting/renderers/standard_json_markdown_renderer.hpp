@@ -4,12 +4,16 @@
 
 #include <string>
 
+class ReportOutputSink;
 struct StandardReport;
 
 class StandardJsonMarkdownRenderer {
  public:
   static auto render(const StandardReport& standard_report) -> std::string;
   static auto render(const std::string& standard_report_json) -> std::string;
+  // 把报表逐块写入 sink，不在内存中拼出完整文档。
+  static void render_to(const StandardReport& standard_report,
+                        ReportOutputSink& sink);
 };
 
 #endif  // REPORTS_CORE_STANDARD_JSON_MARKDOWN_RENDERER_H_
@@ -1,11 +1,10 @@
 #include "standard_json_typst_renderer.hpp"
 
 #include <cmath>
-#include <iomanip>
-#include <sstream>
 #include <stdexcept>
 #include <string>
 
+#include "report_output_sink.hpp"
 #include "reporting/standard_report/standard_report_dto.hpp"
 #include "standard_report_render_support.hpp"
 
@@ -39,28 +38,24 @@ auto escape_typst(const std::string& input) -> std::string {
   return output;
 }
 
-auto render_monthly_remark(const std::string& remark) -> std::string {
+void render_monthly_remark(const std::string& remark, ReportTextWriter& output) {
   const auto lines = render_support::SplitRemarkLinesOrDash(remark);
-  std::ostringstream output;
   output << "- 备注: " << escape_typst(lines.front());
   for (std::size_t index = 1U; index < lines.size(); ++index) {
     output << " \\\n  " << escape_typst(lines[index]);
   }
-  return output.str();
 }
 
-auto render_monthly(const StandardReport& report) -> std::string {
+void render_monthly(const StandardReport& report, ReportTextWriter& output) {
   const std::string period_label =
       render_support::FormatMonthlyPeriodLabel(report.period_start);
 
-  std::ostringstream output;
-  output << std::fixed << std::setprecision(2);
   output << "#set text(font: \"Noto Serif SC\")\n";
   if (!report.data_found) {
     output << "= " << render_support::MonthlyTitleText(report.period_start)
            << "\n\n";
     output << "未找到 " << period_label << " 的任何数据。\n";
-    return output.str();
+    return;
   }
 
   output << "= " << render_support::MonthlyTitleText(report.period_start) << "\n\n";
@@ -68,7 +63,8 @@ auto render_monthly(const StandardReport& report) -> std::string {
   output << "- 收入: CNY" << report.total_income << "\n";
   output << "- 支出: CNY" << report.total_expense << "\n";
   output << "- 结余: CNY" << report.balance << "\n";
-  output << render_monthly_remark(report.remark) << "\n";
+  render_monthly_remark(report.remark, output);
+  output << "\n";
 
   for (const auto& category : report.categories) {
     const double parent_pct =
@@ -93,20 +89,17 @@ auto render_monthly(const StandardReport& report) -> std::string {
       }
     }
   }
-  return output.str();
 }
 
-auto render_yearly(const StandardReport& report) -> std::string {
+void render_yearly(const StandardReport& report, ReportTextWriter& output) {
   const std::string year_text =
       report.period_start.size() >= 4U ? report.period_start.substr(0U, 4U)
                                        : "0000";
-  std::ostringstream output;
-  output << std::fixed << std::setprecision(2);
   output << "#set text(font: \"Noto Serif SC\")\n";
   output << "= " << year_text << "年 消费总览\n\n";
   if (!report.data_found) {
     output << "未找到 " << year_text << " 年的任何数据。\n";
-    return output.str();
+    return;
   }
 
   output << "*年总收入:* CNY" << report.total_income << "  \\\n";
@@ -116,25 +109,80 @@ auto render_yearly(const StandardReport& report) -> std::string {
   output << "  columns: 4,\n";
   output << "  [月份], [收入], [支出], [结余],\n";
   for (const auto& month_item : report.monthly_summary) {
-    output << "  [" << year_text << "-" << std::setw(2) << std::setfill('0')
-           << month_item.month << "], ";
+    output << "  [" << year_text << "-" << ZeroPadded2{month_item.month}
+           << "], ";
     output << "[CNY " << month_item.income << "], ";
     output << "[CNY " << month_item.expense << "], ";
     output << "[CNY " << (month_item.income + month_item.expense) << "],\n";
   }
   output << ")\n";
-  return output.str();
+}
+
+void render_range(const StandardReport& report, ReportTextWriter& output) {
+  const std::string title =
+      render_support::RangeTitleText(report.period_start, report.period_end);
+  output << "#set text(font: \"Noto Serif SC\")\n";
+  output << "= " << title << "\n\n";
+  if (!report.data_found) {
+    output << "未找到 "
+           << render_support::FormatMonthlyPeriodLabel(report.period_start)
+           << " 至 " << render_support::FormatMonthlyPeriodLabel(report.period_end)
+           << " 的任何数据。\n";
+    return;
+  }
+
+  output << "*区间总收入:* CNY" << report.total_income << "  \\\n";
+  output << "*区间总支出:* CNY" << report.total_expense << "  \\\n";
+  output << "*区间结余:* CNY" << report.balance << "\n\n";
+  output << "#table(\n";
+  output << "  columns: 4,\n";
+  output << "  [月份], [收入], [支出], [结余],\n";
+  for (const auto& month_item : report.monthly_summary) {
+    output << "  ["
+           << render_support::RangeMonthLabel(month_item.year, month_item.month)
+           << "], ";
+    output << "[CNY " << month_item.income << "], ";
+    output << "[CNY " << month_item.expense << "], ";
+    output << "[CNY " << month_item.balance << "],\n";
+  }
+  output << ")\n";
+
+  for (const auto& category : report.categories) {
+    const double parent_pct =
+        report.total_expense != 0.0
+            ? std::abs(category.total / report.total_expense * 100.0)
+            : 0.0;
+    output << "\n== " << escape_typst(category.name) << "\n";
+    output << "*总计:* CNY" << category.total << "  \\\n";
+    output << "*占总支出:* " << parent_pct << "%\n";
+    for (const auto& sub_category : category.sub_categories) {
+      output << "- " << escape_typst(sub_category.name) << ": CNY"
+             << sub_category.subtotal << "\n";
+    }
+  }
 }
 
 }  // namespace
 
 auto StandardJsonTypstRenderer::render(const StandardReport& standard_report)
     -> std::string {
+  std::string output;
+  StringReportOutputSink sink(output);
+  render_to(standard_report, sink);
+  return output;
+}
+
+void StandardJsonTypstRenderer::render_to(const StandardReport& standard_report,
+                                          ReportOutputSink& sink) {
+  ReportTextWriter output(sink);
   if (standard_report.report_type == "monthly") {
-    return render_monthly(standard_report);
-  }
-  if (standard_report.report_type == "yearly") {
-    return render_yearly(standard_report);
+    render_monthly(standard_report, output);
+  } else if (standard_report.report_type == "yearly") {
+    render_yearly(standard_report, output);
+  } else if (standard_report.report_type == "range") {
+    render_range(standard_report, output);
+  } else {
+    throw std::runtime_error("Unsupported report_type in standard report JSON.");
   }
-  throw std::runtime_error("Unsupported report_type in standard report JSON.");
+  output.Flush();
 }
@@ -3,11 +3,14 @@
 
 #include <string>
 
+class ReportOutputSink;
 struct StandardReport;
 
 class StandardJsonTypstRenderer {
  public:
   static auto render(const StandardReport& standard_report) -> std::string;
+  static void render_to(const StandardReport& standard_report,
+                        ReportOutputSink& sink);
 };
 
 #endif  // REPORTS_CORE_STANDARD_JSON_TYPST_RENDERER_H_
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <algorithm>
 #include <cctype>
 #include <string>
 #include <vector>
 
+#include "reporting/standard_report/standard_report_dto.hpp"
+
 namespace bills::core::reporting::render_support {
 
 inline auto StripMonthHyphen(const std::string& period_start) -> std::string {
@@ -76,8 +79,80 @@ inline auto SplitRemarkLinesOrDash(const std::string& remark)
   return lines;
 }
 
+inline auto RangeTitleText(const std::string& period_start,
+                           const std::string& period_end) -> std::string {
+  return FormatMonthlyPeriodLabel(period_start) + " 至 " +
+         FormatMonthlyPeriodLabel(period_end) + " 区间报告";
+}
+
+inline auto RangeMonthLabel(int year, int month) -> std::string {
+  std::string label = std::to_string(year) + "-";
+  if (month < 10) {
+    label.push_back('0');
+  }
+  label += std::to_string(month);
+  return label;
+}
+
 inline auto MonthlyTitleText(const std::string& period_start) -> std::string {
   return FormatMonthlyPeriodLabel(period_start) + " 月报";
 }
 
+// 排序视图只保存指向原报表的指针，报表必须比视图活得更久。
+struct SortedSubCategoryView {
+  const StandardSubCategoryItem* sub_category = nullptr;
+  std::vector<const StandardTransactionItem*> transactions;
+};
+
+struct SortedCategoryView {
+  const StandardCategoryItem* category = nullptr;
+  std::vector<SortedSubCategoryView> sub_categories;
+};
+
+// 父类别按总额、交易按金额从高到低排列，子类别保持原顺序；
+// 只排列指针，不复制任何交易文本。
+inline auto SortCategoriesByTotal(const StandardReport& report)
+    -> std::vector<SortedCategoryView> {
+  std::vector<SortedCategoryView> categories;
+  categories.reserve(report.categories.size());
+  for (const auto& category : report.categories) {
+    SortedCategoryView category_view{.category = &category, .sub_categories = {}};
+    category_view.sub_categories.reserve(category.sub_categories.size());
+    for (const auto& sub_category : category.sub_categories) {
+      SortedSubCategoryView sub_view{.sub_category = &sub_category,
+                                     .transactions = {}};
+      sub_view.transactions.reserve(sub_category.transactions.size());
+      for (const auto& transaction : sub_category.transactions) {
+        sub_view.transactions.push_back(&transaction);
+      }
+      std::ranges::sort(sub_view.transactions,
+                        [](const StandardTransactionItem* left,
+                           const StandardTransactionItem* right) -> bool {
+                          return left->amount > right->amount;
+                        });
+      category_view.sub_categories.push_back(std::move(sub_view));
+    }
+    categories.push_back(std::move(category_view));
+  }
+  std::ranges::sort(categories, [](const SortedCategoryView& left,
+                                   const SortedCategoryView& right) -> bool {
+    return left.category->total > right.category->total;
+  });
+  return categories;
+}
+
+inline auto SortMonthsAscending(const StandardReport& report)
+    -> std::vector<const StandardMonthlySummaryItem*> {
+  std::vector<const StandardMonthlySummaryItem*> months;
+  months.reserve(report.monthly_summary.size());
+  for (const auto& month_item : report.monthly_summary) {
+    months.push_back(&month_item);
+  }
+  std::ranges::sort(months, [](const StandardMonthlySummaryItem* left,
+                               const StandardMonthlySummaryItem* right) -> bool {
+    return left->month < right->month;
+  });
+  return months;
+}
+
 }  // namespace bills::core::reporting::render_support
@@ -7,6 +7,7 @@
 #include <string_view>
 #include <vector>
 
+#include "report_output_sink.hpp"
 #include "reporting/standard_report/standard_report_json_serializer.hpp"
 #include "standard_json_latex_renderer.hpp"
 #include "standard_json_markdown_renderer.hpp"
@@ -17,7 +18,7 @@ namespace {
 
 struct RendererEntry {
   std::string_view canonical_name;
-  auto (*render)(const StandardReport&) -> std::string;
+  void (*render_to)(const StandardReport&, ReportOutputSink&);
 };
 
 auto to_ascii_lower(std::string_view format_name) -> std::string {
@@ -43,37 +44,28 @@ auto canonical_format_name(std::string_view format_name) -> std::string {
   return normalized;
 }
 
-auto render_json(const StandardReport& standard_report) -> std::string {
-  return StandardReportJsonSerializer::ToString(standard_report);
+void render_json_to(const StandardReport& standard_report,
+                    ReportOutputSink& sink) {
+  StandardReportJsonSerializer::WriteTo(standard_report, sink);
 }
 
-auto render_markdown(const StandardReport& standard_report) -> std::string {
-  return StandardJsonMarkdownRenderer::render(standard_report);
-}
-
-#if BILLS_CORE_ENABLE_RENDERER_TEX
-auto render_latex(const StandardReport& standard_report) -> std::string {
-  return StandardJsonLatexRenderer::render(standard_report);
-}
-#endif
-
 auto renderer_entries() -> const std::vector<RendererEntry>& {
   static const std::vector<RendererEntry> entries = [] {
     std::vector<RendererEntry> value;
 #if BILLS_CORE_ENABLE_RENDERER_JSON
-    value.push_back({"json", &render_json});
+    value.push_back({"json", &render_json_to});
 #endif
 #if BILLS_CORE_ENABLE_RENDERER_MD
-    value.push_back({"md", &render_markdown});
+    value.push_back({"md", &StandardJsonMarkdownRenderer::render_to});
 #endif
 #if BILLS_CORE_ENABLE_RENDERER_RST
-    value.push_back({"rst", &StandardJsonRstRenderer::render});
+    value.push_back({"rst", &StandardJsonRstRenderer::render_to});
 #endif
 #if BILLS_CORE_ENABLE_RENDERER_TEX
-    value.push_back({"tex", &render_latex});
+    value.push_back({"tex", &StandardJsonLatexRenderer::render_to});
 #endif
 #if BILLS_CORE_ENABLE_RENDERER_TYP
-    value.push_back({"typ", &StandardJsonTypstRenderer::render});
+    value.push_back({"typ", &StandardJsonTypstRenderer::render_to});
 #endif
     return value;
   }();
@@ -109,6 +101,15 @@ auto StandardReportRendererRegistry::IsFormatAvailable(
 auto StandardReportRendererRegistry::Render(
     const StandardReport& standard_report, std::string_view format_name)
     -> std::string {
+  std::string output;
+  StringReportOutputSink sink(output);
+  RenderTo(standard_report, format_name, sink);
+  return output;
+}
+
+void StandardReportRendererRegistry::RenderTo(
+    const StandardReport& standard_report, std::string_view format_name,
+    ReportOutputSink& sink) {
   const std::string canonical = canonical_format_name(format_name);
   const auto it = std::ranges::find_if(
       renderer_entries(), [&canonical](const RendererEntry& entry) -> bool {
@@ -118,5 +119,5 @@ auto StandardReportRendererRegistry::Render(
     throw std::runtime_error("Report format '" + canonical +
                              "' is not available in the current build.");
   }
-  return it->render(standard_report);
+  it->render_to(standard_report, sink);
 }
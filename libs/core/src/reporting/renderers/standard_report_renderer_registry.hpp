@@ -5,6 +5,7 @@
 #include <string_view>
 #include <vector>
 
+class ReportOutputSink;
 struct StandardReport;
 
 class StandardReportRendererRegistry {
@@ -17,6 +18,9 @@ class StandardReportRendererRegistry {
   [[nodiscard]] static auto Render(const StandardReport& standard_report,
                                    std::string_view format_name)
       -> std::string;
+  // 与 Render 输出一致，但分块写入 sink；格式不可用时抛出 std::runtime_error。
+  static void RenderTo(const StandardReport& standard_report,
+                       std::string_view format_name, ReportOutputSink& sink);
 };
 
 #endif  // REPORTS_CORE_STANDARD_REPORT_RENDERER_REGISTRY_H_
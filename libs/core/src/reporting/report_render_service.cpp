@@ -1,6 +1,7 @@
 #include "reporting/report_render_service.hpp"
 
 #include <stdexcept>
+#include <utility>
 
 #include "reporting/renderers/standard_report_renderer_registry.hpp"
 #include "reporting/standard_report/standard_report_assembler.hpp"
@@ -13,10 +14,28 @@ auto ReportRenderService::BuildStandardReport(const QueryExecutionResult& query_
   if (query_result.query_type == "month") {
     return StandardReportAssembler::FromMonthly(query_result.monthly_data);
   }
+  if (query_result.query_type == "range") {
+    return StandardReportAssembler::FromRange(query_result.range_data);
+  }
   throw std::invalid_argument("Unsupported query type for standard report rendering.");
 }
 
+auto ReportRenderService::BuildStandardReport(QueryExecutionResult&& query_result)
+    -> StandardReport {
+  if (query_result.query_type == "month") {
+    return StandardReportAssembler::FromMonthly(
+        std::move(query_result.monthly_data));
+  }
+  return BuildStandardReport(std::as_const(query_result));
+}
+
 auto ReportRenderService::Render(const StandardReport& report,
                                  std::string_view format_name) -> std::string {
   return StandardReportRendererRegistry::Render(report, format_name);
 }
+
+void ReportRenderService::RenderTo(const StandardReport& report,
+                                   std::string_view format_name,
+                                   ReportOutputSink& sink) {
+  StandardReportRendererRegistry::RenderTo(report, format_name, sink);
+}
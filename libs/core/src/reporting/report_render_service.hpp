@@ -6,14 +6,22 @@
 #include "query/query_service.hpp"
 #include "reporting/standard_report/standard_report_dto.hpp"
 
+class ReportOutputSink;
+
 class ReportRenderService {
  public:
   [[nodiscard]] static auto BuildStandardReport(const QueryExecutionResult& query_result)
       -> StandardReport;
+  // 从即将丢弃的查询结果组装报表，交易文本移入报表而不是复制。
+  [[nodiscard]] static auto BuildStandardReport(QueryExecutionResult&& query_result)
+      -> StandardReport;
 
   [[nodiscard]] static auto Render(const StandardReport& report,
                                    std::string_view format_name)
       -> std::string;
+
+  static void RenderTo(const StandardReport& report,
+                       std::string_view format_name, ReportOutputSink& sink);
 };
 
 #endif  // REPORTING_REPORT_RENDER_SERVICE_HPP_
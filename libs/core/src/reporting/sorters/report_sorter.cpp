@@ -4,30 +4,40 @@
 #include "report_sorter.hpp"
 
 #include <algorithm>  // for std::sort
+#include <utility>
 
 // 实现静态方法
 auto ReportSorter::sort_report_data(const MonthlyReportData& data)
-    -> std::vector<std::pair<std::string, ParentCategoryData>> {
-  // 1. 内部交易按金额排序
-  auto sorted_data = data.aggregated_data;  // 创建一个副本以进行排序
-  for (auto& parent_pair : sorted_data) {
-    for (auto& sub_pair : parent_pair.second.sub_categories) {
-      std::ranges::sort(sub_pair.second.transactions,
-                        [](const Transaction& left,
-                           const Transaction& right) -> bool {
-                          return left.amount > right.amount;
+    -> std::vector<SortedParentCategoryData> {
+  std::vector<SortedParentCategoryData> sorted_parents;
+  sorted_parents.reserve(data.aggregated_data.size());
+  for (const auto& [parent_name, parent_data] : data.aggregated_data) {
+    SortedParentCategoryData parent{
+        .name = &parent_name, .data = &parent_data, .sub_categories = {}};
+    parent.sub_categories.reserve(parent_data.sub_categories.size());
+    for (const auto& [sub_name, sub_data] : parent_data.sub_categories) {
+      SortedSubCategoryData sub{
+          .name = &sub_name, .data = &sub_data, .transactions = {}};
+      sub.transactions.reserve(sub_data.transactions.size());
+      for (const auto& transaction : sub_data.transactions) {
+        sub.transactions.push_back(&transaction);
+      }
+      // 1. 内部交易按金额排序
+      std::ranges::sort(sub.transactions,
+                        [](const Transaction* left,
+                           const Transaction* right) -> bool {
+                          return left->amount > right->amount;
                         });
+      parent.sub_categories.push_back(std::move(sub));
     }
+    sorted_parents.push_back(std::move(parent));
   }
 
   // 2. 父类别按总金额排序
-  std::vector<std::pair<std::string, ParentCategoryData>> sorted_parents;
-  for (const auto& pair : sorted_data) {
-    sorted_parents.emplace_back(pair);
-  }
-  std::ranges::sort(sorted_parents, [](const auto& left, const auto& right)
-                                        -> auto {
-    return left.second.parent_total > right.second.parent_total;
+  std::ranges::sort(sorted_parents, [](const SortedParentCategoryData& left,
+                                       const SortedParentCategoryData& right)
+                                        -> bool {
+    return left.data->parent_total > right.data->parent_total;
   });
 
   return sorted_parents;
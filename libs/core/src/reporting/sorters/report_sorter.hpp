@@ -7,6 +7,19 @@
 
 #include "ports/contracts/reports/monthly/monthly_report_data.hpp"
 
+// 排序视图只保存指向原始数据的指针，原始数据必须比视图活得更久。
+struct SortedSubCategoryData {
+  const std::string* name = nullptr;
+  const SubCategoryData* data = nullptr;
+  std::vector<const Transaction*> transactions;
+};
+
+struct SortedParentCategoryData {
+  const std::string* name = nullptr;
+  const ParentCategoryData* data = nullptr;
+  std::vector<SortedSubCategoryData> sub_categories;
+};
+
 /**
  * @class ReportSorter
  * @brief 一个工具类，提供对报表数据进行排序的静态方法。
@@ -25,11 +38,11 @@ class ReportSorter {
    * categories）按其总金额（parent_total）从高到低排序。
    *
    * @param data 从数据库查询出的原始聚合数据。
-   * @return 返回一个 std::vector，其中包含了按总金额排好序的父类别键值对。
-   *         这个结构非常便于格式化器进行遍历和渲染。
+   * @return 按总金额排好序的父类别视图，只排列指向 data 的指针，
+   *         不复制任何类别名或交易文本；子类别保持原有顺序。
    */
-  static std::vector<std::pair<std::string, ParentCategoryData>>
-  sort_report_data(const MonthlyReportData& data);
+  static auto sort_report_data(const MonthlyReportData& data)
+      -> std::vector<SortedParentCategoryData>;
 };
 
 #endif  // REPORTS_MONTHLY_REPORT_REPORT_SORTER_H_
@@ -5,6 +5,10 @@
 #include <ctime>
 #include <iomanip>
 #include <sstream>
+#include <string>
+#include <utility>
+
+#include "common/iso_period.hpp"
 
 namespace {
 constexpr int kLastMonthOfYear = 12;
@@ -29,10 +33,10 @@ auto MonthToText(const int kYear, const int kMonth) -> std::string {
   return output.str();
 }
 
-}  // namespace
-
-auto StandardReportAssembler::FromMonthly(const MonthlyReportData& data)
-    -> StandardReport {
+// kMoveText 为 true 时把交易描述与备注从查询结果中移出，
+// 组装后的报表与查询结果不会同时持有同一份交易文本。
+template <bool kMoveText, typename MonthlyData>
+auto AssembleMonthly(MonthlyData& data) -> StandardReport {
   StandardReport report;
   report.report_type = "monthly";
   report.generated_at_utc = NowUtcIso8601();
@@ -40,29 +44,38 @@ auto StandardReportAssembler::FromMonthly(const MonthlyReportData& data)
   report.period_end = report.period_start;
   report.remark = data.remark;
   report.data_found = data.data_found;
-  report.total_income = data.total_income;
-  report.total_expense = data.total_expense;
-  report.balance = data.balance;
+  report.total_income = data.total_income.ToDouble();
+  report.total_expense = data.total_expense.ToDouble();
+  report.balance = data.balance.ToDouble();
+  report.vocabulary = data.vocabulary;
 
-  for (const auto& [parent_name, parent_data] : data.aggregated_data) {
+  report.categories.reserve(data.aggregated_data.size());
+  for (auto& [parent_name, parent_data] : data.aggregated_data) {
     StandardCategoryItem parent_item;
     parent_item.name = parent_name;
-    parent_item.total = parent_data.parent_total;
+    parent_item.total = parent_data.parent_total.ToDouble();
+    parent_item.sub_categories.reserve(parent_data.sub_categories.size());
 
-    for (const auto& [sub_name, sub_data] : parent_data.sub_categories) {
+    for (auto& [sub_name, sub_data] : parent_data.sub_categories) {
       StandardSubCategoryItem sub_item;
       sub_item.name = sub_name;
-      sub_item.subtotal = sub_data.sub_total;
+      sub_item.subtotal = sub_data.sub_total.ToDouble();
+      sub_item.transactions.reserve(sub_data.transactions.size());
 
-      for (const auto& transaction : sub_data.transactions) {
+      for (auto& transaction : sub_data.transactions) {
         StandardTransactionItem transaction_item;
         transaction_item.parent_category = transaction.parent_category;
         transaction_item.sub_category = transaction.sub_category;
         transaction_item.transaction_type = transaction.transaction_type;
-        transaction_item.description = transaction.description;
         transaction_item.source = transaction.source;
-        transaction_item.comment = transaction.comment;
-        transaction_item.amount = transaction.amount;
+        transaction_item.amount = transaction.amount.ToDouble();
+        if constexpr (kMoveText) {
+          transaction_item.description = std::move(transaction.description);
+          transaction_item.comment = std::move(transaction.comment);
+        } else {
+          transaction_item.description = transaction.description;
+          transaction_item.comment = transaction.comment;
+        }
         sub_item.transactions.push_back(std::move(transaction_item));
       }
 
@@ -75,6 +88,18 @@ auto StandardReportAssembler::FromMonthly(const MonthlyReportData& data)
   return report;
 }
 
+}  // namespace
+
+auto StandardReportAssembler::FromMonthly(const MonthlyReportData& data)
+    -> StandardReport {
+  return AssembleMonthly<false>(data);
+}
+
+auto StandardReportAssembler::FromMonthly(MonthlyReportData&& data)
+    -> StandardReport {
+  return AssembleMonthly<true>(data);
+}
+
 auto StandardReportAssembler::FromYearly(const YearlyReportData& data)
     -> StandardReport {
   StandardReport report;
@@ -83,16 +108,59 @@ auto StandardReportAssembler::FromYearly(const YearlyReportData& data)
   report.period_start = MonthToText(data.year, 1);
   report.period_end = MonthToText(data.year, kLastMonthOfYear);
   report.data_found = data.data_found;
-  report.total_income = data.total_income;
-  report.total_expense = data.total_expense;
-  report.balance = data.balance;
+  report.total_income = data.total_income.ToDouble();
+  report.total_expense = data.total_expense.ToDouble();
+  report.balance = data.balance.ToDouble();
 
   for (const auto& [month, summary] : data.monthly_summary) {
     StandardMonthlySummaryItem month_item;
     month_item.month = month;
-    month_item.income = summary.income;
-    month_item.expense = summary.expense;
-    month_item.balance = summary.income - summary.expense;
+    month_item.income = summary.income.ToDouble();
+    month_item.expense = summary.expense.ToDouble();
+    month_item.balance = (summary.income - summary.expense).ToDouble();
+    report.monthly_summary.push_back(std::move(month_item));
+  }
+
+  return report;
+}
+
+auto StandardReportAssembler::FromRange(const RangeReportData& data)
+    -> StandardReport {
+  StandardReport report;
+  report.report_type = "range";
+  report.generated_at_utc = NowUtcIso8601();
+  report.period_start = MonthToText(data.start_year, data.start_month);
+  report.period_end = MonthToText(data.end_year, data.end_month);
+  report.data_found = data.data_found;
+  report.total_income = data.total_income.ToDouble();
+  report.total_expense = data.total_expense.ToDouble();
+  report.balance = data.balance.ToDouble();
+
+  for (const auto& [parent_name, parent_data] : data.aggregated_data) {
+    StandardCategoryItem parent_item;
+    parent_item.name = parent_name;
+    parent_item.total = parent_data.parent_total.ToDouble();
+    for (const auto& [sub_name, sub_data] : parent_data.sub_categories) {
+      parent_item.sub_categories.push_back(
+          {.name = sub_name, .subtotal = sub_data.sub_total.ToDouble(), .transactions = {}});
+    }
+    report.categories.push_back(std::move(parent_item));
+  }
+
+  for (const auto& [iso_month, summary] : data.monthly_summary) {
+    // 月份键来自 RangeQuery 的 bill_date，理论上总是 YYYY-MM；非法键直接跳过，
+    // 不让单条脏数据中断整段区间报表。
+    const auto parsed_month =
+        bills::core::common::iso_period::parse_year_month(iso_month);
+    if (!parsed_month.has_value()) {
+      continue;
+    }
+    StandardMonthlySummaryItem month_item;
+    month_item.year = parsed_month->year;
+    month_item.month = parsed_month->month;
+    month_item.income = summary.income.ToDouble();
+    month_item.expense = summary.expense.ToDouble();
+    month_item.balance = (summary.income + summary.expense).ToDouble();
     report.monthly_summary.push_back(std::move(month_item));
   }
 
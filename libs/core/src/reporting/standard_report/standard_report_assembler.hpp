@@ -3,6 +3,7 @@
 #define REPORTING_STANDARD_REPORT_STANDARD_REPORT_ASSEMBLER_H_
 
 #include "ports/contracts/reports/monthly/monthly_report_data.hpp"
+#include "ports/contracts/reports/range/range_report_data.hpp"
 #include "ports/contracts/reports/yearly/yearly_report_data.hpp"
 #include "reporting/standard_report/standard_report_dto.hpp"
 
@@ -10,8 +11,13 @@ class StandardReportAssembler {
  public:
   [[nodiscard]] static auto FromMonthly(const MonthlyReportData& data)
       -> StandardReport;
+  // 交易描述与备注直接从 data 中移出，适合查询结果随后即被丢弃的调用方。
+  [[nodiscard]] static auto FromMonthly(MonthlyReportData&& data)
+      -> StandardReport;
   [[nodiscard]] static auto FromYearly(const YearlyReportData& data)
       -> StandardReport;
+  [[nodiscard]] static auto FromRange(const RangeReportData& data)
+      -> StandardReport;
 };
 
 #endif  // REPORTING_STANDARD_REPORT_STANDARD_REPORT_ASSEMBLER_H_
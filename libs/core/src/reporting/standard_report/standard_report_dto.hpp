@@ -2,15 +2,20 @@
 #ifndef REPORTING_STANDARD_REPORT_STANDARD_REPORT_DTO_H_
 #define REPORTING_STANDARD_REPORT_STANDARD_REPORT_DTO_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "domain/bill/bill_vocabulary.hpp"
+
+// 分类、收支类型与来源为 StandardReport::vocabulary 中的编号。金额是渲染与
+// JSON 输出用的 double，由组装器从整数分（Money）换算而来。
 struct StandardTransactionItem {
-  std::string parent_category;
-  std::string sub_category;
-  std::string transaction_type;
+  VocabularyId parent_category = kEmptyVocabularyId;
+  VocabularyId sub_category = kEmptyVocabularyId;
+  VocabularyId transaction_type = kEmptyVocabularyId;
+  VocabularyId source = kEmptyVocabularyId;
   std::string description;
-  std::string source;
   std::string comment;
   double amount = 0.0;
 };
@@ -28,6 +33,8 @@ struct StandardCategoryItem {
 };
 
 struct StandardMonthlySummaryItem {
+  // 仅 range 报表跨年时填写；yearly 报表保持 0，序列化时省略。
+  int year = 0;
   int month = 0;
   double income = 0.0;
   double expense = 0.0;
@@ -51,6 +58,9 @@ struct StandardReport {
 
   std::vector<StandardCategoryItem> categories;
   std::vector<StandardMonthlySummaryItem> monthly_summary;
+
+  // 交易编号所属的词表，序列化时据此取出文本；没有交易明细时可以为空。
+  std::shared_ptr<const BillVocabulary> vocabulary;
 };
 
 #endif  // REPORTING_STANDARD_REPORT_STANDARD_REPORT_DTO_H_
@@ -1,83 +1,108 @@
 // reporting/standard_report/standard_report_json_serializer.cpp
 #include "reporting/standard_report/standard_report_json_serializer.hpp"
 
-auto StandardReportJsonSerializer::ToJson(const StandardReport& report)
-    -> nlohmann::ordered_json {
-  nlohmann::ordered_json root;
-
-  root["meta"] = {
-      {"schema_version", report.schema_version},
-      {"report_type", report.report_type},
-      {"generated_at_utc", report.generated_at_utc},
-      {"source", report.source},
-  };
-
-  root["scope"] = {
-      {"period_start", report.period_start},
-      {"period_end", report.period_end},
-      {"remark", report.remark},
-      {"data_found", report.data_found},
-  };
-
-  root["summary"] = {
-      {"total_income", report.total_income},
-      {"total_expense", report.total_expense},
-      {"balance", report.balance},
-  };
-
-  nlohmann::ordered_json categories_json = nlohmann::ordered_json::array();
+#include <memory>
+
+void StandardReportJsonSerializer::WriteTo(
+    const StandardReport& report, ReportOutputSink& sink,
+    const ExtensionsWriter& write_extensions) {
+  ReportJsonWriter writer(sink);
+  writer.BeginObject();
+
+  writer.Key("meta");
+  writer.BeginObject();
+  writer.StringField("schema_version", report.schema_version);
+  writer.StringField("report_type", report.report_type);
+  writer.StringField("generated_at_utc", report.generated_at_utc);
+  writer.StringField("source", report.source);
+  writer.EndObject();
+
+  writer.Key("scope");
+  writer.BeginObject();
+  writer.StringField("period_start", report.period_start);
+  writer.StringField("period_end", report.period_end);
+  writer.StringField("remark", report.remark);
+  writer.BoolField("data_found", report.data_found);
+  writer.EndObject();
+
+  writer.Key("summary");
+  writer.BeginObject();
+  writer.NumberField("total_income", report.total_income);
+  writer.NumberField("total_expense", report.total_expense);
+  writer.NumberField("balance", report.balance);
+  writer.EndObject();
+
+  writer.Key("items");
+  writer.BeginObject();
+  writer.Key("categories");
+  writer.BeginArray();
   for (const auto& category : report.categories) {
-    nlohmann::ordered_json sub_categories_json = nlohmann::ordered_json::array();
+    writer.BeginObject();
+    writer.StringField("name", category.name);
+    writer.NumberField("total", category.total);
+    writer.Key("sub_categories");
+    writer.BeginArray();
     for (const auto& sub_category : category.sub_categories) {
-      nlohmann::ordered_json transactions_json = nlohmann::ordered_json::array();
+      writer.BeginObject();
+      writer.StringField("name", sub_category.name);
+      writer.NumberField("subtotal", sub_category.subtotal);
+      writer.Key("transactions");
+      writer.BeginArray();
       for (const auto& tx : sub_category.transactions) {
-        transactions_json.push_back({
-            {"parent_category", tx.parent_category},
-            {"sub_category", tx.sub_category},
-            {"transaction_type", tx.transaction_type},
-            {"description", tx.description},
-            {"source", tx.source},
-            {"comment", tx.comment},
-            {"amount", tx.amount},
-        });
+        const BillVocabulary& vocabulary = *report.vocabulary;
+        writer.BeginObject();
+        writer.StringField("parent_category",
+                           vocabulary.Text(tx.parent_category));
+        writer.StringField("sub_category", vocabulary.Text(tx.sub_category));
+        writer.StringField("transaction_type",
+                           vocabulary.Text(tx.transaction_type));
+        writer.StringField("description", tx.description);
+        writer.StringField("source", vocabulary.Text(tx.source));
+        writer.StringField("comment", tx.comment);
+        writer.NumberField("amount", tx.amount);
+        writer.EndObject();
       }
-
-      sub_categories_json.push_back({
-          {"name", sub_category.name},
-          {"subtotal", sub_category.subtotal},
-          {"transactions", std::move(transactions_json)},
-      });
+      writer.EndArray();
+      writer.EndObject();
     }
-
-    categories_json.push_back({
-        {"name", category.name},
-        {"total", category.total},
-        {"sub_categories", std::move(sub_categories_json)},
-    });
+    writer.EndArray();
+    writer.EndObject();
   }
+  writer.EndArray();
 
-  nlohmann::ordered_json monthly_summary_json = nlohmann::ordered_json::array();
+  writer.Key("monthly_summary");
+  writer.BeginArray();
   for (const auto& month_item : report.monthly_summary) {
-    monthly_summary_json.push_back({
-        {"month", month_item.month},
-        {"income", month_item.income},
-        {"expense", month_item.expense},
-        {"balance", month_item.balance},
-    });
+    writer.BeginObject();
+    if (month_item.year != 0) {
+      writer.IntegerField("year", month_item.year);
+    }
+    writer.IntegerField("month", month_item.month);
+    writer.NumberField("income", month_item.income);
+    writer.NumberField("expense", month_item.expense);
+    writer.NumberField("balance", month_item.balance);
+    writer.EndObject();
   }
+  writer.EndArray();
+  writer.EndObject();
 
-  root["items"] = {
-      {"categories", std::move(categories_json)},
-      {"monthly_summary", std::move(monthly_summary_json)},
-  };
+  writer.Key("extensions");
+  writer.BeginObject();
+  if (write_extensions) {
+    write_extensions(writer);
+  }
+  writer.EndObject();
 
-  root["extensions"] = nlohmann::ordered_json::object();
-  return root;
+  writer.EndObject();
+  writer.Flush();
 }
 
 auto StandardReportJsonSerializer::ToString(const StandardReport& report)
     -> std::string {
-  return ToJson(report).dump(2);
+  std::string output;
+  StringReportOutputSink sink(output);
+  WriteTo(report, sink);
+  return output;
 }
 
 auto StandardReportJsonSerializer::FromJson(
@@ -117,6 +142,8 @@ auto StandardReportJsonSerializer::FromJson(
 
     if (const auto categories_it = items.find("categories");
         categories_it != items.end() && categories_it->is_array()) {
+      // 同一报表内的分类、来源与收支类型文本登记在报表自己的词表中。
+      auto vocabulary = std::make_shared<BillVocabulary>();
       for (const auto& category_json : *categories_it) {
         if (!category_json.is_object()) {
           continue;
@@ -148,15 +175,16 @@ auto StandardReportJsonSerializer::FromJson(
                 }
 
                 StandardTransactionItem transaction;
-                transaction.parent_category =
-                    transaction_json.value("parent_category", "");
-                transaction.sub_category =
-                    transaction_json.value("sub_category", "");
-                transaction.transaction_type =
-                    transaction_json.value("transaction_type", "");
+                transaction.parent_category = vocabulary->Intern(
+                    transaction_json.value("parent_category", ""));
+                transaction.sub_category = vocabulary->Intern(
+                    transaction_json.value("sub_category", ""));
+                transaction.transaction_type = vocabulary->Intern(
+                    transaction_json.value("transaction_type", ""));
                 transaction.description =
                     transaction_json.value("description", "");
-                transaction.source = transaction_json.value("source", "");
+                transaction.source =
+                    vocabulary->Intern(transaction_json.value("source", ""));
                 transaction.comment = transaction_json.value("comment", "");
                 transaction.amount = transaction_json.value("amount", 0.0);
                 sub_category.transactions.push_back(std::move(transaction));
@@ -169,6 +197,7 @@ auto StandardReportJsonSerializer::FromJson(
 
         report.categories.push_back(std::move(category));
       }
+      report.vocabulary = std::move(vocabulary);
     }
 
     if (const auto monthly_summary_it = items.find("monthly_summary");
@@ -179,6 +208,7 @@ auto StandardReportJsonSerializer::FromJson(
         }
 
         StandardMonthlySummaryItem month_item;
+        month_item.year = month_json.value("year", 0);
         month_item.month = month_json.value("month", 0);
         month_item.income = month_json.value("income", 0.0);
         month_item.expense = month_json.value("expense", 0.0);
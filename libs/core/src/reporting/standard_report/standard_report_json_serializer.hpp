@@ -2,15 +2,22 @@
 #ifndef REPORTING_STANDARD_REPORT_STANDARD_REPORT_JSON_SERIALIZER_H_
 #define REPORTING_STANDARD_REPORT_STANDARD_REPORT_JSON_SERIALIZER_H_
 
+#include <functional>
 #include <string>
 
 #include "nlohmann/json.hpp"
+#include "reporting/renderers/report_json_writer.hpp"
+#include "reporting/renderers/report_output_sink.hpp"
 #include "reporting/standard_report/standard_report_dto.hpp"
 
 class StandardReportJsonSerializer {
  public:
-  [[nodiscard]] static auto ToJson(const StandardReport& report)
-      -> nlohmann::ordered_json;
+  // 在 "extensions" 对象内追加成员（先 Key 再写值）；为空时输出 "extensions": {}。
+  using ExtensionsWriter = std::function<void(ReportJsonWriter&)>;
+
+  // 一次遍历把报表流式写入 sink，不构建中间 JSON 树。
+  static void WriteTo(const StandardReport& report, ReportOutputSink& sink,
+                      const ExtensionsWriter& write_extensions = {});
   [[nodiscard]] static auto ToString(const StandardReport& report) -> std::string;
   [[nodiscard]] static auto FromJson(
       const nlohmann::ordered_json& report_json) -> StandardReport;
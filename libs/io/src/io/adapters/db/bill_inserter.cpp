@@ -2,11 +2,26 @@
 
 #include "bill_inserter.hpp"
 
+#include <exception>
 #include <stdexcept>
 #include <utility>
 
 #include "database_manager.hpp"  // 包含新的数据访问层头文件
 
+namespace {
+
+// 删除可能存在的旧账单，再写入账单记录及其全部交易记录。
+void write_bill(DatabaseManager& db_manager, const ParsedBill& bill_data) {
+  if (bill_data.date.empty()) {
+    throw std::runtime_error("无法插入日期为空的账单。");
+  }
+  db_manager.delete_bill_by_year_month(bill_data.year, bill_data.month);
+  sqlite3_int64 bill_id = db_manager.insert_bill_record(bill_data);
+  db_manager.insert_transactions_for_bill(bill_id, bill_data);
+}
+
+}  // namespace
+
 BillInserter::BillInserter(std::string db_path)
     : m_db_path(std::move(db_path)) {}
 
@@ -26,14 +41,8 @@ void BillInserter::insert_bill(const ParsedBill& bill_data) {
     // 业务流程步骤 1: 开始事务
     db_manager.begin_transaction();
 
-    // 业务流程步骤 2: 删除可能存在的旧账单
-    db_manager.delete_bill_by_year_month(bill_data.year, bill_data.month);
-
-    // 业务流程步骤 3: 插入新的账单记录并获取ID
-    sqlite3_int64 bill_id = db_manager.insert_bill_record(bill_data);
-
-    // 业务流程步骤 4: 插入所有关联的交易记录
-    db_manager.insert_transactions_for_bill(bill_id, bill_data.transactions);
+    // 业务流程步骤 2-4: 删除旧账单，插入账单记录及其交易记录
+    write_bill(db_manager, bill_data);
 
     // 业务流程步骤 5: 提交事务
     db_manager.commit_transaction();
@@ -44,3 +53,57 @@ void BillInserter::insert_bill(const ParsedBill& bill_data) {
     throw;
   }
 }
+
+auto BillInserter::insert_bills(std::span<const ParsedBill> bills)
+    -> std::vector<BillInsertFailure> {
+  std::vector<BillInsertFailure> failures;
+  if (bills.empty()) {
+    return failures;
+  }
+
+  // 整批共用一个连接与一个事务：建表与语句准备只执行一次，只提交一次。
+  DatabaseManager db_manager(m_db_path);
+  db_manager.initialize_database();
+
+  try {
+    db_manager.begin_transaction();
+    for (std::size_t index = 0; index < bills.size(); ++index) {
+      db_manager.begin_savepoint();
+      try {
+        write_bill(db_manager, bills[index]);
+        db_manager.release_savepoint();
+      } catch (const std::exception& error) {
+        db_manager.rollback_to_savepoint();
+        failures.push_back({.index = index, .message = error.what()});
+      }
+    }
+    db_manager.commit_transaction();
+  } catch (const std::exception& error) {
+    // 事务未能提交时所有账单都没有落库，统一记为失败。
+    db_manager.rollback_transaction();
+    failures.clear();
+    for (std::size_t index = 0; index < bills.size(); ++index) {
+      failures.push_back({.index = index, .message = error.what()});
+    }
+  }
+  return failures;
+}
+
+void BillInserter::insert_bills_atomically(
+    std::span<const ParsedBill> bills,
+    const IngestManifestUpdate& manifest_update) {
+  DatabaseManager db_manager(m_db_path);
+  db_manager.initialize_database();
+
+  try {
+    db_manager.begin_transaction();
+    for (const auto& bill : bills) {
+      write_bill(db_manager, bill);
+    }
+    ApplyIngestManifestUpdate(db_manager, manifest_update);
+    db_manager.commit_transaction();
+  } catch (...) {
+    db_manager.rollback_transaction();
+    throw;
+  }
+}
@@ -3,9 +3,14 @@
 #ifndef BILLS_IO_ADAPTERS_DB_BILL_INSERTER_H_
 #define BILLS_IO_ADAPTERS_DB_BILL_INSERTER_H_
 
+#include <cstddef>
+#include <span>
 #include <string>
+#include <vector>
 
 #include "domain/bill/bill_record.hpp"
+#include "io/adapters/db/ingest_manifest_store.hpp"
+#include "ports/bills_repository.hpp"
 
 /**
  * @class BillInserter
@@ -22,6 +27,24 @@ class BillInserter {
    */
   void insert_bill(const ParsedBill& bill_data);
 
+  /**
+   * @brief 在同一连接、同一事务中批量插入账单，语句只准备一次。
+   * @param bills 待插入的账单，按输入顺序写入。
+   * @return 插入失败的账单及原因；单个账单失败只回滚该账单。
+   * @throws std::runtime_error 如果无法打开或初始化数据库。
+   */
+  auto insert_bills(std::span<const ParsedBill> bills)
+      -> std::vector<BillInsertFailure>;
+
+  /**
+   * @brief 在一个事务中写入全部账单并应用清单修改，要么全部落库，要么都不落库。
+   * @param bills 待插入的账单，同账期的旧账单会被替换。
+   * @param manifest_update 与账单一同提交的 ingest_manifest 修改。
+   * @throws std::runtime_error 如果任何账单或清单写入失败；此时数据库保持原状。
+   */
+  void insert_bills_atomically(std::span<const ParsedBill> bills,
+                               const IngestManifestUpdate& manifest_update);
+
  private:
   std::string m_db_path;  // 只存储数据库路径，而不是连接句柄
 };
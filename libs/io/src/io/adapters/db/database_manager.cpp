@@ -3,6 +3,10 @@
 #include "database_manager.hpp"
 
 #include <iostream>
+#include <optional>
+#include <string>
+
+#include "io/adapters/db/sqlite_performance_profile.hpp"
 
 namespace {
 constexpr int kDeleteBillYearIndex = 1;
@@ -24,6 +28,127 @@ constexpr int kInsertTransactionAmountIndex = 5;
 constexpr int kInsertTransactionSourceIndex = 6;
 constexpr int kInsertTransactionCommentIndex = 7;
 constexpr int kInsertTransactionTypeIndex = 8;
+
+// 当前 schema 版本；每新增一步迁移就递增，并在 kSchemaMigrations 中追加对应 SQL。
+constexpr int kSchemaVersion = 4;
+
+// kSchemaMigrations[i] 把数据库从版本 i 升级到 i + 1。
+constexpr const char* kSchemaMigrations[kSchemaVersion] = {
+    // v1: 年/月查询与按账单读取交易时使用的索引。
+    "CREATE INDEX IF NOT EXISTS idx_bills_year_month ON bills(year, month);"
+    " CREATE INDEX IF NOT EXISTS idx_transactions_bill_category"
+    " ON transactions(bill_id, parent_category, sub_category);",
+    // v2: 增量入库清单，记录每个源文件上次成功入库时的指纹与写入的账单。
+    "CREATE TABLE IF NOT EXISTS ingest_manifest ("
+    " source_path TEXT PRIMARY KEY,"
+    " bill_date TEXT NOT NULL,"
+    " bill_id INTEGER NOT NULL,"
+    " size INTEGER NOT NULL,"
+    " mtime_ns INTEGER NOT NULL,"
+    " content_hash TEXT NOT NULL,"
+    " config_hash TEXT NOT NULL"
+    ");",
+    // v3: 指纹的确认时间，用于识别 mtime 不足以证明未变的“竞态”记录。
+    // 旧记录为 0（未知），首次增量入库时会重新比较一次内容哈希。
+    "ALTER TABLE ingest_manifest"
+    " ADD COLUMN verified_ns INTEGER NOT NULL DEFAULT 0;",
+    // v4: 金额列由 REAL 改为 INTEGER 分。SQLite 不支持修改列类型，按新结构
+    // 重建两张表并保留 id（ingest_manifest.bill_id 依赖账单 id），旧值按
+    // ROUND(x * 100) 换算；重命名时 transactions 的外键随之指向新 bills。
+    "CREATE TABLE bills_v4 ("
+    " id INTEGER PRIMARY KEY AUTOINCREMENT,"
+    " bill_date TEXT NOT NULL UNIQUE,"
+    " year INTEGER NOT NULL CHECK(year BETWEEN 1900 AND 9999),"
+    " month INTEGER NOT NULL CHECK(month BETWEEN 1 AND 12),"
+    " remark TEXT,"
+    " total_income INTEGER NOT NULL DEFAULT 0,"
+    " total_expense INTEGER NOT NULL DEFAULT 0,"
+    " balance INTEGER NOT NULL DEFAULT 0,"
+    " CHECK(bill_date = printf('%04d-%02d', year, month))"
+    ");"
+    " INSERT INTO bills_v4 (id, bill_date, year, month, remark, total_income,"
+    " total_expense, balance)"
+    " SELECT id, bill_date, year, month, remark,"
+    " CAST(ROUND(total_income * 100) AS INTEGER),"
+    " CAST(ROUND(total_expense * 100) AS INTEGER),"
+    " CAST(ROUND(balance * 100) AS INTEGER) FROM bills;"
+    " CREATE TABLE transactions_v4 ("
+    " id INTEGER PRIMARY KEY AUTOINCREMENT,"
+    " bill_id INTEGER NOT NULL,"
+    " parent_category TEXT NOT NULL,"
+    " sub_category TEXT NOT NULL,"
+    " description TEXT,"
+    " amount INTEGER NOT NULL,"
+    " source TEXT NOT NULL DEFAULT 'manually_add',"
+    " comment TEXT,"
+    " transaction_type TEXT NOT NULL DEFAULT 'Expense',"
+    " FOREIGN KEY (bill_id) REFERENCES bills_v4(id) ON DELETE CASCADE"
+    ");"
+    " INSERT INTO transactions_v4 (id, bill_id, parent_category, sub_category,"
+    " description, amount, source, comment, transaction_type)"
+    " SELECT id, bill_id, parent_category, sub_category, description,"
+    " CAST(ROUND(amount * 100) AS INTEGER), source, comment, transaction_type"
+    " FROM transactions;"
+    " DROP TABLE transactions;"
+    " DROP TABLE bills;"
+    " ALTER TABLE bills_v4 RENAME TO bills;"
+    " ALTER TABLE transactions_v4 RENAME TO transactions;"
+    " CREATE INDEX idx_bills_year_month ON bills(year, month);"
+    " CREATE INDEX idx_transactions_bill_category"
+    " ON transactions(bill_id, parent_category, sub_category);",
+};
+
+constexpr const char* kDeleteBillSql =
+    "DELETE FROM bills WHERE year = ? AND month = ?;";
+constexpr const char* kInsertBillSql =
+    "INSERT INTO bills (bill_date, year, month, remark, total_income, "
+    "total_expense, balance) VALUES (?, ?, ?, ?, ?, ?, ?);";
+constexpr const char* kInsertTransactionSql =
+    "INSERT INTO transactions (bill_id, parent_category, sub_category, "
+    "description, amount, source, comment, transaction_type) "
+    "VALUES (?, ?, ?, ?, ?, ?, ?, ?);";
+
+constexpr const char* kDeleteBillByIdSql = "DELETE FROM bills WHERE id = ?;";
+constexpr const char* kFindBillIdSql =
+    "SELECT id FROM bills WHERE bill_date = ?;";
+// bill_current 表示清单记录的账单仍在库中，未被其他写入路径替换或删除。
+constexpr const char* kLoadIngestManifestSql =
+    "SELECT m.source_path, m.bill_date, m.bill_id, m.size, m.mtime_ns,"
+    " m.content_hash, m.config_hash, m.verified_ns, b.id IS NOT NULL"
+    " FROM ingest_manifest m LEFT JOIN bills b ON b.id = m.bill_id"
+    " AND b.bill_date = m.bill_date ORDER BY m.source_path;";
+constexpr const char* kUpsertIngestManifestSql =
+    "INSERT INTO ingest_manifest (source_path, bill_date, bill_id, size,"
+    " mtime_ns, content_hash, config_hash, verified_ns)"
+    " VALUES (?, ?, ?, ?, ?, ?, ?, ?)"
+    " ON CONFLICT(source_path) DO UPDATE SET bill_date = excluded.bill_date,"
+    " bill_id = excluded.bill_id, size = excluded.size,"
+    " mtime_ns = excluded.mtime_ns, content_hash = excluded.content_hash,"
+    " config_hash = excluded.config_hash,"
+    " verified_ns = excluded.verified_ns;";
+constexpr const char* kDeleteIngestManifestSql =
+    "DELETE FROM ingest_manifest WHERE source_path = ?;";
+
+constexpr int kManifestSourcePathIndex = 1;
+constexpr int kManifestBillDateIndex = 2;
+constexpr int kManifestBillIdIndex = 3;
+constexpr int kManifestSizeIndex = 4;
+constexpr int kManifestMtimeIndex = 5;
+constexpr int kManifestContentHashIndex = 6;
+constexpr int kManifestConfigHashIndex = 7;
+constexpr int kManifestVerifiedIndex = 8;
+
+auto ColumnText(sqlite3_stmt* stmt, int column) -> std::string {
+  const auto* text =
+      reinterpret_cast<const char*>(sqlite3_column_text(stmt, column));
+  return text != nullptr ? std::string(text) : std::string();
+}
+
+// 复用前清除上一次执行的状态与绑定，保证语句处于干净状态。
+void ResetStatement(sqlite3_stmt* stmt) {
+  sqlite3_reset(stmt);
+  sqlite3_clear_bindings(stmt);
+}
 }  // namespace
 
 DatabaseManager::DatabaseManager(const std::string& db_path) : m_db(nullptr) {
@@ -37,9 +162,23 @@ DatabaseManager::DatabaseManager(const std::string& db_path) : m_db(nullptr) {
     throw std::runtime_error("无法启用外键支持: " +
                              std::string(sqlite3_errmsg(m_db)));
   }
+  try {
+    bills::io::ApplySqlitePerformanceProfile(
+        m_db, bills::io::GetSqlitePerformanceProfile(), true);
+  } catch (...) {
+    sqlite3_close(m_db);
+    throw;
+  }
 }
 
 DatabaseManager::~DatabaseManager() {
+  sqlite3_finalize(m_delete_bill_stmt);
+  sqlite3_finalize(m_insert_bill_stmt);
+  sqlite3_finalize(m_insert_transaction_stmt);
+  sqlite3_finalize(m_delete_bill_by_id_stmt);
+  sqlite3_finalize(m_find_bill_id_stmt);
+  sqlite3_finalize(m_upsert_manifest_stmt);
+  sqlite3_finalize(m_delete_manifest_stmt);
   if (m_db != nullptr) {
     sqlite3_close(m_db);
   }
@@ -48,7 +187,9 @@ DatabaseManager::~DatabaseManager() {
 void DatabaseManager::initialize_database() {
   char* errmsg = nullptr;
   // --- 【核心修改 1】 ---
-  // 更新 bills 表的结构，用三个新字段替换 total_amount
+  // 更新 bills 表的结构，用三个新字段替换 total_amount。
+  // 这里建的是版本 0 的结构，之后的变化（含 v4 的整数分金额列）都由
+  // migrate_schema() 完成，新旧数据库走同一条升级路径。
   const char* create_bills_sql =
       "CREATE TABLE IF NOT EXISTS bills ("
       " id INTEGER PRIMARY KEY AUTOINCREMENT,"
@@ -89,6 +230,40 @@ void DatabaseManager::initialize_database() {
     sqlite3_free(errmsg);
     throw std::runtime_error("无法创建 transactions 表: " + error_str);
   }
+
+  migrate_schema();
+}
+
+void DatabaseManager::migrate_schema() {
+  sqlite3_stmt* stmt = nullptr;
+  if (sqlite3_prepare_v2(m_db, "PRAGMA user_version;", -1, &stmt, nullptr) !=
+      SQLITE_OK) {
+    throw std::runtime_error("无法读取 schema 版本: " +
+                             std::string(sqlite3_errmsg(m_db)));
+  }
+  int version = 0;
+  if (sqlite3_step(stmt) == SQLITE_ROW) {
+    version = sqlite3_column_int(stmt, 0);
+  }
+  sqlite3_finalize(stmt);
+
+  for (; version < kSchemaVersion; ++version) {
+    // 每一步迁移与版本号更新在同一事务中提交，失败时保持原版本。
+    const std::string sql = std::string("BEGIN TRANSACTION; ") +
+                            kSchemaMigrations[version] +
+                            " PRAGMA user_version = " +
+                            std::to_string(version + 1) + "; COMMIT;";
+    char* errmsg = nullptr;
+    if (sqlite3_exec(m_db, sql.c_str(), nullptr, nullptr, &errmsg) !=
+        SQLITE_OK) {
+      std::string error_str = errmsg != nullptr ? errmsg : "";
+      sqlite3_free(errmsg);
+      rollback_transaction();
+      throw std::runtime_error("schema 迁移到版本 " +
+                               std::to_string(version + 1) +
+                               " 失败: " + error_str);
+    }
+  }
 }
 
 void DatabaseManager::begin_transaction() {
@@ -110,36 +285,58 @@ void DatabaseManager::rollback_transaction() {
   sqlite3_exec(m_db, "ROLLBACK;", nullptr, nullptr, nullptr);
 }
 
-void DatabaseManager::delete_bill_by_year_month(int year, int month) {
-  sqlite3_stmt* stmt = nullptr;
-  const char* sql = "DELETE FROM bills WHERE year = ? AND month = ?;";
-  if (sqlite3_prepare_v2(m_db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
-    throw std::runtime_error("准备 DELETE 语句失败: " +
+void DatabaseManager::begin_savepoint() {
+  if (sqlite3_exec(m_db, "SAVEPOINT bill_insert;", nullptr, nullptr,
+                   nullptr) != SQLITE_OK) {
+    throw std::runtime_error("无法创建保存点: " +
+                             std::string(sqlite3_errmsg(m_db)));
+  }
+}
+
+void DatabaseManager::release_savepoint() {
+  if (sqlite3_exec(m_db, "RELEASE SAVEPOINT bill_insert;", nullptr, nullptr,
+                   nullptr) != SQLITE_OK) {
+    throw std::runtime_error("释放保存点失败: " +
                              std::string(sqlite3_errmsg(m_db)));
   }
+}
+
+void DatabaseManager::rollback_to_savepoint() {
+  sqlite3_exec(m_db,
+               "ROLLBACK TO SAVEPOINT bill_insert;"
+               " RELEASE SAVEPOINT bill_insert;",
+               nullptr, nullptr, nullptr);
+}
+
+auto DatabaseManager::cached_statement(sqlite3_stmt*& slot, const char* sql,
+                                       const char* label) -> sqlite3_stmt* {
+  if (slot == nullptr &&
+      sqlite3_prepare_v2(m_db, sql, -1, &slot, nullptr) != SQLITE_OK) {
+    sqlite3_finalize(slot);
+    slot = nullptr;
+    throw std::runtime_error(std::string("准备 ") + label + " 语句失败: " +
+                             sqlite3_errmsg(m_db));
+  }
+  return slot;
+}
+
+void DatabaseManager::delete_bill_by_year_month(int year, int month) {
+  sqlite3_stmt* stmt =
+      cached_statement(m_delete_bill_stmt, kDeleteBillSql, "DELETE");
   sqlite3_bind_int(stmt, kDeleteBillYearIndex, year);
   sqlite3_bind_int(stmt, kDeleteBillMonthIndex, month);
   if (sqlite3_step(stmt) != SQLITE_DONE) {
-    sqlite3_finalize(stmt);
-    throw std::runtime_error("执行 DELETE 语句失败: " +
-                             std::string(sqlite3_errmsg(m_db)));
+    std::string errmsg = sqlite3_errmsg(m_db);
+    ResetStatement(stmt);
+    throw std::runtime_error("执行 DELETE 语句失败: " + errmsg);
   }
-  sqlite3_finalize(stmt);
+  ResetStatement(stmt);
 }
 
 auto DatabaseManager::insert_bill_record(const ParsedBill& bill_data)
     -> sqlite3_int64 {
-  sqlite3_stmt* stmt = nullptr;
-  // --- 【核心修改 2】 ---
-  // 更新 INSERT 语句以匹配新的表结构
-  const char* sql =
-      "INSERT INTO bills (bill_date, year, month, remark, total_income, "
-      "total_expense, balance) VALUES (?, ?, ?, ?, ?, ?, ?);";
-  // --- 修改结束 ---
-  if (sqlite3_prepare_v2(m_db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
-    throw std::runtime_error("准备 INSERT bill 语句失败: " +
-                             std::string(sqlite3_errmsg(m_db)));
-  }
+  sqlite3_stmt* stmt =
+      cached_statement(m_insert_bill_stmt, kInsertBillSql, "INSERT bill");
 
   sqlite3_bind_text(stmt, kInsertBillDateIndex, bill_data.date.c_str(), -1,
                     SQLITE_STATIC);
@@ -149,48 +346,44 @@ auto DatabaseManager::insert_bill_record(const ParsedBill& bill_data)
                     SQLITE_STATIC);
   // --- 【核心修改 3】 ---
   // 绑定新的总计字段到SQL语句
-  sqlite3_bind_double(stmt, kInsertBillTotalIncomeIndex,
-                      bill_data.total_income);
-  sqlite3_bind_double(stmt, kInsertBillTotalExpenseIndex,
-                      bill_data.total_expense);
-  sqlite3_bind_double(stmt, kInsertBillBalanceIndex, bill_data.balance);
+  // 金额列为 INTEGER（分），见 schema v4。
+  sqlite3_bind_int64(stmt, kInsertBillTotalIncomeIndex,
+                     bill_data.total_income.cents());
+  sqlite3_bind_int64(stmt, kInsertBillTotalExpenseIndex,
+                     bill_data.total_expense.cents());
+  sqlite3_bind_int64(stmt, kInsertBillBalanceIndex, bill_data.balance.cents());
   // --- 修改结束 ---
 
   if (sqlite3_step(stmt) != SQLITE_DONE) {
-    sqlite3_finalize(stmt);
-    throw std::runtime_error("插入 bill 数据失败: " +
-                             std::string(sqlite3_errmsg(m_db)));
+    std::string errmsg = sqlite3_errmsg(m_db);
+    ResetStatement(stmt);
+    throw std::runtime_error("插入 bill 数据失败: " + errmsg);
   }
-  sqlite3_finalize(stmt);
+  ResetStatement(stmt);
   return sqlite3_last_insert_rowid(m_db);
 }
 
 void DatabaseManager::insert_transactions_for_bill(
-    sqlite3_int64 bill_id, const std::vector<Transaction>& transactions) {
-  sqlite3_stmt* stmt = nullptr;
-
-  const char* sql =
-      "INSERT INTO transactions (bill_id, parent_category, sub_category, "
-      "description, amount, source, comment, transaction_type) "
-      "VALUES (?, ?, ?, ?, ?, ?, ?, ?);";
-
-  if (sqlite3_prepare_v2(m_db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
-    throw std::runtime_error("准备 INSERT transaction 语句失败: " +
-                             std::string(sqlite3_errmsg(m_db)));
-  }
+    sqlite3_int64 bill_id, const ParsedBill& bill_data) {
+  sqlite3_stmt* stmt = cached_statement(
+      m_insert_transaction_stmt, kInsertTransactionSql, "INSERT transaction");
 
-  for (const auto& transaction : transactions) {
+  for (const auto& transaction : bill_data.transactions) {
+    const BillVocabulary& vocabulary = *bill_data.vocabulary;
     sqlite3_bind_int64(stmt, kInsertTransactionBillIdIndex, bill_id);
     sqlite3_bind_text(stmt, kInsertTransactionParentCategoryIndex,
-                      transaction.parent_category.c_str(), -1, SQLITE_STATIC);
+                      vocabulary.Text(transaction.parent_category).c_str(), -1,
+                      SQLITE_STATIC);
     sqlite3_bind_text(stmt, kInsertTransactionSubCategoryIndex,
-                      transaction.sub_category.c_str(), -1, SQLITE_STATIC);
+                      vocabulary.Text(transaction.sub_category).c_str(), -1,
+                      SQLITE_STATIC);
     sqlite3_bind_text(stmt, kInsertTransactionDescriptionIndex,
                       transaction.description.c_str(), -1, SQLITE_STATIC);
-    sqlite3_bind_double(stmt, kInsertTransactionAmountIndex,
-                        transaction.amount);
+    sqlite3_bind_int64(stmt, kInsertTransactionAmountIndex,
+                       transaction.amount.cents());
     sqlite3_bind_text(stmt, kInsertTransactionSourceIndex,
-                      transaction.source.c_str(), -1, SQLITE_STATIC);
+                      vocabulary.Text(transaction.source).c_str(), -1,
+                      SQLITE_STATIC);
     if (transaction.comment.empty()) {
       sqlite3_bind_null(stmt, kInsertTransactionCommentIndex);
     } else {
@@ -199,15 +392,115 @@ void DatabaseManager::insert_transactions_for_bill(
     }
 
     sqlite3_bind_text(stmt, kInsertTransactionTypeIndex,
-                      transaction.transaction_type.c_str(), -1,
-                      SQLITE_STATIC);
+                      vocabulary.Text(transaction.transaction_type).c_str(),
+                      -1, SQLITE_STATIC);
 
     if (sqlite3_step(stmt) != SQLITE_DONE) {
-      sqlite3_finalize(stmt);
-      throw std::runtime_error("插入 transaction 数据失败: " +
-                               std::string(sqlite3_errmsg(m_db)));
+      std::string errmsg = sqlite3_errmsg(m_db);
+      ResetStatement(stmt);
+      throw std::runtime_error("插入 transaction 数据失败: " + errmsg);
     }
     sqlite3_reset(stmt);
   }
+  ResetStatement(stmt);
+}
+
+void DatabaseManager::delete_bill_by_id(sqlite3_int64 bill_id) {
+  sqlite3_stmt* stmt = cached_statement(m_delete_bill_by_id_stmt,
+                                        kDeleteBillByIdSql, "DELETE bill");
+  sqlite3_bind_int64(stmt, 1, bill_id);
+  if (sqlite3_step(stmt) != SQLITE_DONE) {
+    std::string errmsg = sqlite3_errmsg(m_db);
+    ResetStatement(stmt);
+    throw std::runtime_error("删除 bill 数据失败: " + errmsg);
+  }
+  ResetStatement(stmt);
+}
+
+auto DatabaseManager::find_bill_id(const std::string& bill_date)
+    -> std::optional<sqlite3_int64> {
+  sqlite3_stmt* stmt =
+      cached_statement(m_find_bill_id_stmt, kFindBillIdSql, "SELECT bill id");
+  sqlite3_bind_text(stmt, 1, bill_date.c_str(), -1, SQLITE_STATIC);
+  std::optional<sqlite3_int64> bill_id;
+  const int step_result = sqlite3_step(stmt);
+  if (step_result == SQLITE_ROW) {
+    bill_id = sqlite3_column_int64(stmt, 0);
+  } else if (step_result != SQLITE_DONE) {
+    std::string errmsg = sqlite3_errmsg(m_db);
+    ResetStatement(stmt);
+    throw std::runtime_error("查询 bill id 失败: " + errmsg);
+  }
+  ResetStatement(stmt);
+  return bill_id;
+}
+
+auto DatabaseManager::load_ingest_manifest()
+    -> std::vector<IngestManifestEntry> {
+  sqlite3_stmt* stmt = nullptr;
+  if (sqlite3_prepare_v2(m_db, kLoadIngestManifestSql, -1, &stmt, nullptr) !=
+      SQLITE_OK) {
+    throw std::runtime_error("准备 SELECT ingest_manifest 语句失败: " +
+                             std::string(sqlite3_errmsg(m_db)));
+  }
+  std::vector<IngestManifestEntry> entries;
+  int step_result = SQLITE_ROW;
+  while ((step_result = sqlite3_step(stmt)) == SQLITE_ROW) {
+    entries.push_back(IngestManifestEntry{
+        .source_path = ColumnText(stmt, 0),
+        .bill_date = ColumnText(stmt, 1),
+        .bill_id = sqlite3_column_int64(stmt, 2),
+        .size = sqlite3_column_int64(stmt, 3),
+        .mtime_ns = sqlite3_column_int64(stmt, 4),
+        .content_hash = ColumnText(stmt, 5),
+        .config_hash = ColumnText(stmt, 6),
+        .verified_ns = sqlite3_column_int64(stmt, 7),
+        .bill_current = sqlite3_column_int(stmt, 8) != 0,
+    });
+  }
+  if (step_result != SQLITE_DONE) {
+    std::string errmsg = sqlite3_errmsg(m_db);
+    sqlite3_finalize(stmt);
+    throw std::runtime_error("读取 ingest_manifest 失败: " + errmsg);
+  }
   sqlite3_finalize(stmt);
+  return entries;
+}
+
+void DatabaseManager::upsert_ingest_manifest_entry(
+    const IngestManifestEntry& entry) {
+  sqlite3_stmt* stmt = cached_statement(
+      m_upsert_manifest_stmt, kUpsertIngestManifestSql, "UPSERT manifest");
+  sqlite3_bind_text(stmt, kManifestSourcePathIndex, entry.source_path.c_str(),
+                    -1, SQLITE_STATIC);
+  sqlite3_bind_text(stmt, kManifestBillDateIndex, entry.bill_date.c_str(), -1,
+                    SQLITE_STATIC);
+  sqlite3_bind_int64(stmt, kManifestBillIdIndex, entry.bill_id);
+  sqlite3_bind_int64(stmt, kManifestSizeIndex, entry.size);
+  sqlite3_bind_int64(stmt, kManifestMtimeIndex, entry.mtime_ns);
+  sqlite3_bind_text(stmt, kManifestContentHashIndex,
+                    entry.content_hash.c_str(), -1, SQLITE_STATIC);
+  sqlite3_bind_text(stmt, kManifestConfigHashIndex, entry.config_hash.c_str(),
+                    -1, SQLITE_STATIC);
+  sqlite3_bind_int64(stmt, kManifestVerifiedIndex, entry.verified_ns);
+  if (sqlite3_step(stmt) != SQLITE_DONE) {
+    std::string errmsg = sqlite3_errmsg(m_db);
+    ResetStatement(stmt);
+    throw std::runtime_error("写入 ingest_manifest 失败: " + errmsg);
+  }
+  ResetStatement(stmt);
+}
+
+void DatabaseManager::delete_ingest_manifest_entry(
+    const std::string& source_path) {
+  sqlite3_stmt* stmt = cached_statement(
+      m_delete_manifest_stmt, kDeleteIngestManifestSql, "DELETE manifest");
+  sqlite3_bind_text(stmt, kManifestSourcePathIndex, source_path.c_str(), -1,
+                    SQLITE_STATIC);
+  if (sqlite3_step(stmt) != SQLITE_DONE) {
+    std::string errmsg = sqlite3_errmsg(m_db);
+    ResetStatement(stmt);
+    throw std::runtime_error("删除 ingest_manifest 记录失败: " + errmsg);
+  }
+  ResetStatement(stmt);
 }
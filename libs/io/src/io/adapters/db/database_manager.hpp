@@ -5,12 +5,29 @@
 
 #include <sqlite3.h>
 
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
 #include "domain/bill/bill_record.hpp"
 
+// ingest_manifest 表中的一行：某个源文件上次成功入库时的指纹。
+struct IngestManifestEntry {
+  std::string source_path;
+  std::string bill_date;
+  sqlite3_int64 bill_id = 0;
+  sqlite3_int64 size = 0;
+  sqlite3_int64 mtime_ns = 0;
+  std::string content_hash;
+  std::string config_hash;
+  // 记录该指纹时的时间（与 mtime_ns 同一时钟），0 表示未知。mtime 距此不足
+  // 时间戳粒度时，相同的 size/mtime 仍可能掩盖随后的写入，需要重新比较内容哈希。
+  sqlite3_int64 verified_ns = 0;
+  // 读取时填充：bill_id 对应的账单仍在库中，且未被其他写入路径替换。
+  bool bill_current = false;
+};
+
 /**
  * @class DatabaseManager
  * @brief 负责所有底层的数据库交互，包括连接、Schema管理和CRUD操作。
@@ -25,6 +42,7 @@ class DatabaseManager {
   DatabaseManager& operator=(const DatabaseManager&) = delete;
 
   // --- Schema Management ---
+  // 建表并按 PRAGMA user_version 逐级执行迁移，旧库原地升级而不是重建。
   void initialize_database();
 
   // --- Transaction Management ---
@@ -32,14 +50,41 @@ class DatabaseManager {
   void commit_transaction();
   void rollback_transaction();
 
+  // 单个账单的保存点：批量事务中某个账单失败时只回滚该账单。
+  void begin_savepoint();
+  void release_savepoint();
+  void rollback_to_savepoint();
+
   // --- Data Manipulation (CRUD) ---
   void delete_bill_by_year_month(int year, int month);
   sqlite3_int64 insert_bill_record(const ParsedBill& bill_data);
-  void insert_transactions_for_bill(
-      sqlite3_int64 bill_id, const std::vector<Transaction>& transactions);
+  // 分类等编号经 bill_data.vocabulary 取回文本后绑定。
+  void insert_transactions_for_bill(sqlite3_int64 bill_id,
+                                    const ParsedBill& bill_data);
+  void delete_bill_by_id(sqlite3_int64 bill_id);
+  auto find_bill_id(const std::string& bill_date)
+      -> std::optional<sqlite3_int64>;
+
+  // --- Ingest Manifest ---
+  auto load_ingest_manifest() -> std::vector<IngestManifestEntry>;
+  void upsert_ingest_manifest_entry(const IngestManifestEntry& entry);
+  void delete_ingest_manifest_entry(const std::string& source_path);
 
  private:
+  void migrate_schema();
+
+  // 语句在首次使用时准备，并在连接生命周期内复用。
+  auto cached_statement(sqlite3_stmt*& slot, const char* sql,
+                        const char* label) -> sqlite3_stmt*;
+
   sqlite3* m_db;  // SQLite 数据库连接句柄
+  sqlite3_stmt* m_delete_bill_stmt = nullptr;
+  sqlite3_stmt* m_insert_bill_stmt = nullptr;
+  sqlite3_stmt* m_insert_transaction_stmt = nullptr;
+  sqlite3_stmt* m_delete_bill_by_id_stmt = nullptr;
+  sqlite3_stmt* m_find_bill_id_stmt = nullptr;
+  sqlite3_stmt* m_upsert_manifest_stmt = nullptr;
+  sqlite3_stmt* m_delete_manifest_stmt = nullptr;
 };
 
 #endif  // BILLS_IO_ADAPTERS_DB_DATABASE_MANAGER_H_
@@ -0,0 +1,34 @@
+// io/adapters/db/ingest_manifest_store.cpp
+
+#include "ingest_manifest_store.hpp"
+
+#include <utility>
+
+void ApplyIngestManifestUpdate(DatabaseManager& db_manager,
+                               const IngestManifestUpdate& update) {
+  for (const auto bill_id : update.removed_bill_ids) {
+    db_manager.delete_bill_by_id(bill_id);
+  }
+  for (const auto& source_path : update.dropped_paths) {
+    db_manager.delete_ingest_manifest_entry(source_path);
+  }
+  for (auto entry : update.upserts) {
+    // 账单写入后才知道 id；查不到说明账单已不存在，不记录指纹以便下次重试。
+    const auto bill_id = db_manager.find_bill_id(entry.bill_date);
+    if (!bill_id.has_value()) {
+      db_manager.delete_ingest_manifest_entry(entry.source_path);
+      continue;
+    }
+    entry.bill_id = *bill_id;
+    db_manager.upsert_ingest_manifest_entry(entry);
+  }
+}
+
+IngestManifestStore::IngestManifestStore(std::string db_path)
+    : m_db_path(std::move(db_path)) {}
+
+auto IngestManifestStore::Load() -> std::vector<IngestManifestEntry> {
+  DatabaseManager db_manager(m_db_path);
+  db_manager.initialize_database();
+  return db_manager.load_ingest_manifest();
+}
@@ -0,0 +1,47 @@
+// io/adapters/db/ingest_manifest_store.hpp
+
+#ifndef BILLS_IO_ADAPTERS_DB_INGEST_MANIFEST_STORE_H_
+#define BILLS_IO_ADAPTERS_DB_INGEST_MANIFEST_STORE_H_
+
+#include <string>
+#include <vector>
+
+#include "io/adapters/db/database_manager.hpp"
+
+// 一次增量入库后对清单的全部修改，在同一事务中提交。
+struct IngestManifestUpdate {
+  // 本次成功入库文件的新指纹；bill_id 在提交时按 bill_date 现查。
+  std::vector<IngestManifestEntry> upserts;
+  // 源文件已消失、需要移出清单的路径。
+  std::vector<std::string> dropped_paths;
+  // 随源文件一起消失、需要从库中删除的账单。
+  std::vector<sqlite3_int64> removed_bill_ids;
+};
+
+/**
+ * @brief 在调用方已开启的事务中应用清单修改，与账单写入共用同一事务
+ *        （见 BillInserter::insert_bills_atomically）。
+ * @throws std::runtime_error 如果任何数据库操作失败；由调用方负责回滚。
+ */
+void ApplyIngestManifestUpdate(DatabaseManager& db_manager,
+                               const IngestManifestUpdate& update);
+
+/**
+ * @class IngestManifestStore
+ * @brief 读取 ingest_manifest 表，供增量入库判断哪些源文件需要重新处理。
+ */
+class IngestManifestStore {
+ public:
+  explicit IngestManifestStore(std::string db_path);
+
+  /**
+   * @brief 读取全部清单记录，并标记各记录写入的账单是否仍在库中。
+   * @throws std::runtime_error 如果无法打开或读取数据库。
+   */
+  [[nodiscard]] auto Load() -> std::vector<IngestManifestEntry>;
+
+ private:
+  std::string m_db_path;
+};
+
+#endif  // BILLS_IO_ADAPTERS_DB_INGEST_MANIFEST_STORE_H_
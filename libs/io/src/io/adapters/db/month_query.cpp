@@ -5,7 +5,12 @@
 #include <algorithm>
 #include <cctype>
 #include <stdexcept>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
+
+#include "io/adapters/db/sqlite_money_column.hpp"
 
 namespace {
 constexpr int kMinSupportedYear = 1900;
@@ -39,9 +44,26 @@ auto ParseIsoMonth(std::string_view iso_month) -> ParsedIsoMonth {
   }
   return parsed;
 }
+
+auto ColumnView(sqlite3_stmt* stmt, int column) -> std::string_view {
+  const auto* raw = reinterpret_cast<const char*>(sqlite3_column_text(stmt, column));
+  if (raw == nullptr) {
+    return {};
+  }
+  return {raw, static_cast<std::size_t>(sqlite3_column_bytes(stmt, column))};
+}
+
+// 行按 (parent_category, sub_category) 有序到达，而 SQLite 的 BINARY 排序与
+// std::string 的字典序一致：新分组总是追加在 map 末尾，只在分组切换时构造一次键。
+template <typename Map>
+auto AppendGroup(Map& groups, std::string_view name) -> typename Map::iterator {
+  return groups.emplace_hint(groups.end(), std::string(name),
+                             typename Map::mapped_type{});
+}
 }  // namespace
 
-MonthQuery::MonthQuery(sqlite3* db_connection) : m_db(db_connection) {}
+MonthQuery::MonthQuery(SqliteStatementCache& statements)
+    : m_statements(statements) {}
 
 auto MonthQuery::read_monthly_data(std::string_view iso_month)
     -> MonthlyReportData {
@@ -51,72 +73,76 @@ auto MonthQuery::read_monthly_data(std::string_view iso_month)
   data.month = parsed.month;
 
   const char* totals_sql =
-      "SELECT total_income, total_expense, balance, remark "
+      "SELECT id, total_income, total_expense, balance, remark "
       "FROM bills WHERE bill_date = ?;";
-  sqlite3_stmt* totals_stmt = nullptr;
-
-  if (sqlite3_prepare_v2(m_db, totals_sql, -1, &totals_stmt, nullptr) !=
-      SQLITE_OK) {
-    throw std::runtime_error("准备查询总计数据的 SQL 语句失败: " +
-                             std::string(sqlite3_errmsg(m_db)));
-  }
-  sqlite3_bind_text(totals_stmt, 1, iso_month.data(),
-                    static_cast<int>(iso_month.size()), SQLITE_TRANSIENT);
-
-  if (sqlite3_step(totals_stmt) == SQLITE_ROW) {
-    data.data_found = true;
-    data.total_income = sqlite3_column_double(totals_stmt, 0);
-    data.total_expense = sqlite3_column_double(totals_stmt, 1);
-    data.balance = sqlite3_column_double(totals_stmt, 2);
-    const unsigned char* remark_raw = sqlite3_column_text(totals_stmt, 3);
-    data.remark = (remark_raw != nullptr)
-                      ? reinterpret_cast<const char*>(remark_raw)
-                      : "";
+  std::int64_t bill_id = 0;
+  {
+    const auto totals_lease = m_statements.Acquire(
+        totals_sql, "准备查询总计数据的 SQL 语句失败: ");
+    sqlite3_stmt* totals_stmt = totals_lease.get();
+    sqlite3_bind_text(totals_stmt, 1, iso_month.data(),
+                      static_cast<int>(iso_month.size()), SQLITE_TRANSIENT);
+
+    if (sqlite3_step(totals_stmt) == SQLITE_ROW) {
+      data.data_found = true;
+      bill_id = sqlite3_column_int64(totals_stmt, 0);
+      data.total_income = ColumnMoney(totals_stmt, 1);
+      data.total_expense = ColumnMoney(totals_stmt, 2);
+      data.balance = ColumnMoney(totals_stmt, 3);
+      data.remark = std::string(ColumnView(totals_stmt, 4));
+    }
   }
-  sqlite3_finalize(totals_stmt);
 
   if (!data.data_found) {
     return data;
   }
 
+  // idx_transactions_bill_category 的键序为 (bill_id, parent, sub, rowid)，
+  // 排序直接由索引顺序满足；id 保持同一子类内的录入顺序。
   const char* sql =
-      "SELECT t.parent_category, t.sub_category, t.amount, t.description "
-      "FROM transactions AS t "
-      "JOIN bills AS b ON t.bill_id = b.id "
-      "WHERE b.bill_date = ?;";
-  sqlite3_stmt* stmt = nullptr;
-
-  if (sqlite3_prepare_v2(m_db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
-    throw std::runtime_error("准备查询交易的 SQL 语句失败: " +
-                             std::string(sqlite3_errmsg(m_db)));
-  }
-
-  sqlite3_bind_text(stmt, 1, iso_month.data(), static_cast<int>(iso_month.size()),
-                    SQLITE_TRANSIENT);
-
+      "SELECT parent_category, sub_category, amount, description "
+      "FROM transactions "
+      "WHERE bill_id = ? "
+      "ORDER BY parent_category, sub_category, id;";
+  const auto lease = m_statements.Acquire(sql, "准备查询交易的 SQL 语句失败: ");
+  sqlite3_stmt* stmt = lease.get();
+  sqlite3_bind_int64(stmt, 1, bill_id);
+
+  using ParentIterator = decltype(data.aggregated_data)::iterator;
+  using SubIterator = decltype(ParentCategoryData::sub_categories)::iterator;
+  ParentIterator parent = data.aggregated_data.end();
+  SubIterator sub;
+  bool has_sub = false;
+  // 分类文本在分组切换时登记一次，交易只保存编号。
+  auto vocabulary = std::make_shared<BillVocabulary>();
+  VocabularyId parent_id = kEmptyVocabularyId;
+  VocabularyId sub_id = kEmptyVocabularyId;
   while (sqlite3_step(stmt) == SQLITE_ROW) {
-    std::string parent_cat =
-        reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
-    std::string sub_cat =
-        reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-    double amount = sqlite3_column_double(stmt, 2);
-    const unsigned char* desc_raw = sqlite3_column_text(stmt, 3);
-
-    Transaction transaction;
-    transaction.parent_category = parent_cat;
-    transaction.sub_category = sub_cat;
+    const std::string_view parent_cat = ColumnView(stmt, 0);
+    const std::string_view sub_cat = ColumnView(stmt, 1);
+    const Money amount = ColumnMoney(stmt, 2);
+
+    if (parent == data.aggregated_data.end() || parent->first != parent_cat) {
+      parent = AppendGroup(data.aggregated_data, parent_cat);
+      parent_id = vocabulary->Intern(parent_cat);
+      has_sub = false;
+    }
+    if (!has_sub || sub->first != sub_cat) {
+      sub = AppendGroup(parent->second.sub_categories, sub_cat);
+      sub_id = vocabulary->Intern(sub_cat);
+      has_sub = true;
+    }
+
+    parent->second.parent_total += amount;
+    sub->second.sub_total += amount;
+
+    Transaction& transaction = sub->second.transactions.emplace_back();
+    transaction.parent_category = parent_id;
+    transaction.sub_category = sub_id;
     transaction.amount = amount;
-    transaction.description =
-        (desc_raw != nullptr) ? reinterpret_cast<const char*>(desc_raw) : "";
-
-    data.aggregated_data[parent_cat].parent_total += amount;
-    data.aggregated_data[parent_cat].sub_categories[sub_cat].sub_total +=
-        amount;
-    data.aggregated_data[parent_cat]
-        .sub_categories[sub_cat]
-        .transactions.push_back(transaction);
+    transaction.description = std::string(ColumnView(stmt, 3));
   }
-  sqlite3_finalize(stmt);
 
+  data.vocabulary = std::move(vocabulary);
   return data;
 }
@@ -6,17 +6,18 @@
 
 #include <string_view>
 
+#include "io/adapters/db/sqlite_statement_cache.hpp"
 #include "ports/contracts/reports/monthly/monthly_report_data.hpp"
 
 class MonthQuery {
  public:
-  explicit MonthQuery(sqlite3* db_connection);
+  explicit MonthQuery(SqliteStatementCache& statements);
 
   // 从数据库读取数据并返回一个填充好的数据结构
   MonthlyReportData read_monthly_data(std::string_view iso_month);
 
  private:
-  sqlite3* m_db;
+  SqliteStatementCache& m_statements;
 };
 
 #endif
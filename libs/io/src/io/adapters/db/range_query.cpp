@@ -0,0 +1,114 @@
+// io/adapters/db/range_query.cpp
+
+#include "range_query.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "common/iso_period.hpp"
+#include "io/adapters/db/sqlite_money_column.hpp"
+
+namespace {
+namespace iso_period = bills::core::common::iso_period;
+
+constexpr int kBillIdColumn = 0;
+constexpr int kBillDateColumn = 1;
+constexpr int kIncomeColumn = 2;
+constexpr int kExpenseColumn = 3;
+constexpr int kParentCategoryColumn = 4;
+constexpr int kSubCategoryColumn = 5;
+constexpr int kAmountColumn = 6;
+
+auto ParseIsoMonth(std::string_view iso_month) -> iso_period::IsoYearMonth {
+  const auto parsed = iso_period::parse_year_month(iso_month);
+  if (!parsed.has_value()) {
+    throw std::invalid_argument("Range queries must use YYYY-MM.");
+  }
+  return *parsed;
+}
+
+auto ColumnText(sqlite3_stmt* stmt, int column) -> std::string {
+  const unsigned char* raw = sqlite3_column_text(stmt, column);
+  return (raw != nullptr) ? reinterpret_cast<const char*>(raw) : "";
+}
+}  // namespace
+
+RangeQuery::RangeQuery(SqliteStatementCache& statements)
+    : m_statements(statements) {}
+
+auto RangeQuery::read_range_data(std::string_view start_iso_month,
+                                 std::string_view end_iso_month)
+    -> RangeReportData {
+  const iso_period::IsoYearMonth start = ParseIsoMonth(start_iso_month);
+  const iso_period::IsoYearMonth end = ParseIsoMonth(end_iso_month);
+  if (start_iso_month > end_iso_month) {
+    throw std::invalid_argument(
+        "Range start month must not be later than end month.");
+  }
+
+  RangeReportData data;
+  data.start_year = start.year;
+  data.start_month = start.month;
+  data.end_year = end.year;
+  data.end_month = end.month;
+
+  // bill_date 为 UNIQUE 列，BETWEEN 走其自动索引；LEFT JOIN 保证没有交易的
+  // 账单仍贡献月度合计。每个账单的首行携带其收支总额。
+  const char* sql =
+      "SELECT b.id, b.bill_date, b.total_income, b.total_expense, "
+      "  t.parent_category, t.sub_category, SUM(t.amount) "
+      "FROM bills AS b "
+      "LEFT JOIN transactions AS t ON t.bill_id = b.id "
+      "WHERE b.bill_date BETWEEN ? AND ? "
+      "GROUP BY b.id, t.parent_category, t.sub_category "
+      "ORDER BY b.bill_date;";
+
+  const auto lease = m_statements.Acquire(sql, "准备区间查询的 SQL 语句失败: ");
+  sqlite3_stmt* stmt = lease.get();
+  sqlite3_bind_text(stmt, 1, start_iso_month.data(),
+                    static_cast<int>(start_iso_month.size()), SQLITE_TRANSIENT);
+  sqlite3_bind_text(stmt, 2, end_iso_month.data(),
+                    static_cast<int>(end_iso_month.size()), SQLITE_TRANSIENT);
+
+  bool has_previous_bill = false;
+  std::int64_t previous_bill_id = 0;
+  int step_result = SQLITE_ROW;
+  while ((step_result = sqlite3_step(stmt)) == SQLITE_ROW) {
+    data.data_found = true;
+    const std::int64_t bill_id = sqlite3_column_int64(stmt, kBillIdColumn);
+    if (!has_previous_bill || bill_id != previous_bill_id) {
+      has_previous_bill = true;
+      previous_bill_id = bill_id;
+      const Money income = ColumnMoney(stmt, kIncomeColumn);
+      const Money expense = ColumnMoney(stmt, kExpenseColumn);
+      auto& month_summary =
+          data.monthly_summary[ColumnText(stmt, kBillDateColumn)];
+      month_summary.income += income;
+      month_summary.expense += expense;
+      data.total_income += income;
+      data.total_expense += expense;
+    }
+
+    if (sqlite3_column_type(stmt, kParentCategoryColumn) == SQLITE_NULL) {
+      continue;
+    }
+    const Money amount = ColumnMoney(stmt, kAmountColumn);
+    auto& parent =
+        data.aggregated_data[ColumnText(stmt, kParentCategoryColumn)];
+    parent.parent_total += amount;
+    parent.sub_categories[ColumnText(stmt, kSubCategoryColumn)].sub_total +=
+        amount;
+  }
+
+  if (step_result != SQLITE_DONE) {
+    throw std::runtime_error(
+        std::string("执行区间查询失败: ") +
+        sqlite3_errmsg(sqlite3_db_handle(stmt)));
+  }
+
+  if (data.data_found) {
+    data.balance = data.total_income + data.total_expense;
+  }
+  return data;
+}
@@ -0,0 +1,24 @@
+// io/adapters/db/range_query.hpp
+#ifndef BILLS_IO_ADAPTERS_DB_RANGE_QUERY_H_
+#define BILLS_IO_ADAPTERS_DB_RANGE_QUERY_H_
+
+#include <sqlite3.h>
+
+#include <string_view>
+
+#include "io/adapters/db/sqlite_statement_cache.hpp"
+#include "ports/contracts/reports/range/range_report_data.hpp"
+
+class RangeQuery {
+ public:
+  explicit RangeQuery(SqliteStatementCache& statements);
+
+  // 单条分组查询读取 [start, end] 内的按月、按分类合计。
+  RangeReportData read_range_data(std::string_view start_iso_month,
+                                  std::string_view end_iso_month);
+
+ private:
+  SqliteStatementCache& m_statements;
+};
+
+#endif  // BILLS_IO_ADAPTERS_DB_RANGE_QUERY_H_
@@ -2,6 +2,8 @@
 
 #include "sqlite_bill_repository.hpp"
 
+#include <utility>
+
 #include "io/adapters/db/bill_inserter.hpp"
 
 SqliteBillRepository::SqliteBillRepository(std::string db_path)
@@ -11,3 +13,9 @@ void SqliteBillRepository::InsertBill(const ParsedBill& bill_data) {
   BillInserter inserter(db_path_);
   inserter.insert_bill(bill_data);
 }
+
+auto SqliteBillRepository::InsertBills(std::span<const ParsedBill> bills)
+    -> std::vector<BillInsertFailure> {
+  BillInserter inserter(db_path_);
+  return inserter.insert_bills(bills);
+}
@@ -2,7 +2,9 @@
 #ifndef BILLS_IO_ADAPTERS_DB_SQLITE_BILL_REPOSITORY_H_
 #define BILLS_IO_ADAPTERS_DB_SQLITE_BILL_REPOSITORY_H_
 
+#include <span>
 #include <string>
+#include <vector>
 
 #include "ports/bills_repository.hpp"
 
@@ -10,6 +12,8 @@ class SqliteBillRepository : public BillRepository {
  public:
   explicit SqliteBillRepository(std::string db_path);
   void InsertBill(const ParsedBill& bill_data) override;
+  auto InsertBills(std::span<const ParsedBill> bills)
+      -> std::vector<BillInsertFailure> override;
 
  private:
   std::string db_path_;
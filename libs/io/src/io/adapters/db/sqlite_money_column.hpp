@@ -0,0 +1,31 @@
+// io/adapters/db/sqlite_money_column.hpp
+#ifndef BILLS_IO_ADAPTERS_DB_SQLITE_MONEY_COLUMN_H_
+#define BILLS_IO_ADAPTERS_DB_SQLITE_MONEY_COLUMN_H_
+
+#include <sqlite3.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "domain/bill/money.hpp"
+
+/**
+ * @brief 读取金额列（或其 SUM），返回整数分。
+ *
+ * schema v4 起金额列为 INTEGER 分，SUM 亦为整数。报表查询以只读方式打开，
+ * 不会触发迁移，因此尚未迁移的旧库仍返回 REAL 元，按两位小数舍入到分。
+ * NULL（如空集合的 SUM）视为 0。
+ */
+inline auto ColumnMoney(sqlite3_stmt* stmt, int column) -> Money {
+  if (sqlite3_column_type(stmt, column) != SQLITE_FLOAT) {
+    return Money::FromCents(sqlite3_column_int64(stmt, column));
+  }
+  const auto amount = Money::FromDouble(sqlite3_column_double(stmt, column));
+  if (!amount.has_value()) {
+    throw std::runtime_error("数据库中的金额超出可表示范围: " +
+                             std::string(sqlite3_column_name(stmt, column)));
+  }
+  return *amount;
+}
+
+#endif  // BILLS_IO_ADAPTERS_DB_SQLITE_MONEY_COLUMN_H_
@@ -0,0 +1,151 @@
+// io/adapters/db/sqlite_performance_profile.cpp
+#include "io/adapters/db/sqlite_performance_profile.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+namespace bills::io {
+namespace {
+
+// 写入连接专用的 PRAGMA：journal_mode 会持久化到数据库文件。
+// 默认档位只在数据库仍处于之前 balanced/bulk 运行留下的 WAL 模式时切回回滚日志；
+// synchronous 与其余连接级参数不持久化，新连接本就是 SQLite 默认值。
+constexpr const char* kJournalModeQuery = "PRAGMA journal_mode;";
+constexpr const char* kDefaultWriterPragmas = "PRAGMA journal_mode = DELETE;";
+constexpr const char* kBalancedWriterPragmas =
+    "PRAGMA journal_mode = WAL;"
+    " PRAGMA synchronous = NORMAL;";
+constexpr const char* kBulkWriterPragmas =
+    "PRAGMA journal_mode = WAL;"
+    " PRAGMA synchronous = OFF;";
+
+// 连接级 PRAGMA：读写连接都适用。cache_size 为负数时单位是 KiB。
+constexpr const char* kBalancedConnectionPragmas =
+    "PRAGMA temp_store = MEMORY;"
+    " PRAGMA cache_size = -16384;"
+    " PRAGMA mmap_size = 67108864;";
+constexpr const char* kBulkConnectionPragmas =
+    "PRAGMA temp_store = MEMORY;"
+    " PRAGMA cache_size = -65536;"
+    " PRAGMA mmap_size = 268435456;";
+
+std::atomic<SqlitePerformanceProfile> g_profile{
+    SqlitePerformanceProfile::kDefault};
+
+void ExecutePragmas(sqlite3* db_connection, const char* sql) {
+  char* errmsg = nullptr;
+  if (sqlite3_exec(db_connection, sql, nullptr, nullptr, &errmsg) !=
+      SQLITE_OK) {
+    std::string error_str =
+        errmsg != nullptr ? errmsg : sqlite3_errmsg(db_connection);
+    sqlite3_free(errmsg);
+    throw std::runtime_error("无法应用 SQLite 性能档位: " + error_str);
+  }
+}
+
+auto QueryJournalMode(sqlite3* db_connection) -> std::string {
+  sqlite3_stmt* stmt = nullptr;
+  if (sqlite3_prepare_v2(db_connection, kJournalModeQuery, -1, &stmt,
+                         nullptr) != SQLITE_OK) {
+    throw std::runtime_error("无法读取 SQLite 日志模式: " +
+                             std::string(sqlite3_errmsg(db_connection)));
+  }
+  std::string mode;
+  const int step_result = sqlite3_step(stmt);
+  if (step_result == SQLITE_ROW) {
+    const auto* text =
+        reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+    if (text != nullptr) {
+      mode = text;
+    }
+  }
+  sqlite3_finalize(stmt);
+  if (step_result != SQLITE_ROW) {
+    throw std::runtime_error("无法读取 SQLite 日志模式: " +
+                             std::string(sqlite3_errmsg(db_connection)));
+  }
+  return mode;
+}
+
+// 其他连接仍打开着 WAL 数据库时，切换日志模式会以 SQLITE_BUSY 失败；此时保留
+// WAL 继续写入（数据照常落盘），等下一次没有其他连接时再切回。
+void RestoreRollbackJournal(sqlite3* db_connection) {
+  if (QueryJournalMode(db_connection) != "wal") {
+    return;
+  }
+  char* errmsg = nullptr;
+  const int result = sqlite3_exec(db_connection, kDefaultWriterPragmas,
+                                  nullptr, nullptr, &errmsg);
+  if (result == SQLITE_OK || (result & 0xFF) == SQLITE_BUSY) {
+    sqlite3_free(errmsg);
+    return;
+  }
+  std::string error_str =
+      errmsg != nullptr ? errmsg : sqlite3_errmsg(db_connection);
+  sqlite3_free(errmsg);
+  throw std::runtime_error("无法应用 SQLite 性能档位: " + error_str);
+}
+
+}  // namespace
+
+auto ParseSqlitePerformanceProfile(std::string_view name)
+    -> std::optional<SqlitePerformanceProfile> {
+  if (name == "default") {
+    return SqlitePerformanceProfile::kDefault;
+  }
+  if (name == "balanced") {
+    return SqlitePerformanceProfile::kBalanced;
+  }
+  if (name == "bulk") {
+    return SqlitePerformanceProfile::kBulk;
+  }
+  return std::nullopt;
+}
+
+auto SqlitePerformanceProfileName(SqlitePerformanceProfile profile)
+    -> std::string_view {
+  switch (profile) {
+    case SqlitePerformanceProfile::kBalanced:
+      return "balanced";
+    case SqlitePerformanceProfile::kBulk:
+      return "bulk";
+    case SqlitePerformanceProfile::kDefault:
+      break;
+  }
+  return "default";
+}
+
+void SetSqlitePerformanceProfile(SqlitePerformanceProfile profile) {
+  g_profile.store(profile, std::memory_order_relaxed);
+}
+
+auto GetSqlitePerformanceProfile() -> SqlitePerformanceProfile {
+  return g_profile.load(std::memory_order_relaxed);
+}
+
+void ApplySqlitePerformanceProfile(sqlite3* db_connection,
+                                   SqlitePerformanceProfile profile,
+                                   bool writable) {
+  switch (profile) {
+    case SqlitePerformanceProfile::kDefault:
+      if (writable) {
+        RestoreRollbackJournal(db_connection);
+      }
+      return;
+    case SqlitePerformanceProfile::kBalanced:
+      if (writable) {
+        ExecutePragmas(db_connection, kBalancedWriterPragmas);
+      }
+      ExecutePragmas(db_connection, kBalancedConnectionPragmas);
+      return;
+    case SqlitePerformanceProfile::kBulk:
+      if (writable) {
+        ExecutePragmas(db_connection, kBulkWriterPragmas);
+      }
+      ExecutePragmas(db_connection, kBulkConnectionPragmas);
+      return;
+  }
+}
+
+}  // namespace bills::io
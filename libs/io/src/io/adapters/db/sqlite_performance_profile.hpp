@@ -0,0 +1,53 @@
+// io/adapters/db/sqlite_performance_profile.hpp
+#ifndef BILLS_IO_ADAPTERS_DB_SQLITE_PERFORMANCE_PROFILE_H_
+#define BILLS_IO_ADAPTERS_DB_SQLITE_PERFORMANCE_PROFILE_H_
+
+#include <sqlite3.h>
+
+#include <optional>
+#include <string_view>
+
+namespace bills::io {
+
+/**
+ * @brief SQLite 连接的性能档位。
+ *
+ * - kDefault: SQLite 默认值（回滚日志、synchronous=FULL）；写入连接会把
+ *   此前档位持久化的 WAL 切回 journal_mode=DELETE。
+ * - kBalanced: WAL + synchronous=NORMAL，内存临时表，较大的页缓存与 mmap。
+ * - kBulk: 在 kBalanced 基础上关闭 fsync，适合可重建数据库的批量导入。
+ */
+enum class SqlitePerformanceProfile {
+  kDefault,
+  kBalanced,
+  kBulk,
+};
+
+inline constexpr std::string_view kSqlitePerformanceProfileNames =
+    "default, balanced, bulk";
+
+[[nodiscard]] auto ParseSqlitePerformanceProfile(std::string_view name)
+    -> std::optional<SqlitePerformanceProfile>;
+
+[[nodiscard]] auto SqlitePerformanceProfileName(
+    SqlitePerformanceProfile profile) -> std::string_view;
+
+// 进程级档位：之后新打开的写入与读取连接都会应用该档位。
+void SetSqlitePerformanceProfile(SqlitePerformanceProfile profile);
+
+[[nodiscard]] auto GetSqlitePerformanceProfile() -> SqlitePerformanceProfile;
+
+/**
+ * @brief 在已打开的连接上应用档位对应的 PRAGMA。
+ * @param writable 只读连接不修改 journal_mode 与 synchronous。
+ * 默认档位的写入连接只在数据库处于 WAL 时切回 DELETE；其他连接仍打开着该数据库时
+ * 切换会返回 SQLITE_BUSY，此时保留 WAL 且不视为错误，下一次独占打开时再切换。
+ * @throws std::runtime_error 如果任一 PRAGMA 执行失败。
+ */
+void ApplySqlitePerformanceProfile(sqlite3* db_connection,
+                                   SqlitePerformanceProfile profile,
+                                   bool writable);
+
+}  // namespace bills::io
+
+#endif  // BILLS_IO_ADAPTERS_DB_SQLITE_PERFORMANCE_PROFILE_H_
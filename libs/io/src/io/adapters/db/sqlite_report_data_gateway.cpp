@@ -4,15 +4,16 @@
 #include <stdexcept>
 #include <string>
 
-#include "io/adapters/db/month_query.hpp"
-#include "io/adapters/db/year_query.hpp"
-
 namespace {
 constexpr int kBillDateColumn = 0;
 }  // namespace
 
 SqliteReportDataGateway::SqliteReportDataGateway(sqlite3* db_connection)
-    : db_connection_(db_connection) {
+    : db_connection_(db_connection),
+      statements_(db_connection),
+      month_query_(statements_),
+      year_query_(statements_),
+      range_query_(statements_) {
   if (db_connection_ == nullptr) {
     throw std::invalid_argument("Database connection must not be null.");
   }
@@ -20,26 +21,26 @@ SqliteReportDataGateway::SqliteReportDataGateway(sqlite3* db_connection)
 
 auto SqliteReportDataGateway::ReadMonthlyData(std::string_view iso_month)
     -> MonthlyReportData {
-  MonthQuery month_query(db_connection_);
-  return month_query.read_monthly_data(iso_month);
+  return month_query_.read_monthly_data(iso_month);
 }
 
 auto SqliteReportDataGateway::ReadYearlyData(std::string_view iso_year)
     -> YearlyReportData {
-  YearQuery year_query(db_connection_);
-  return year_query.read_yearly_data(iso_year);
+  return year_query_.read_yearly_data(iso_year);
+}
+
+auto SqliteReportDataGateway::ReadRangeData(std::string_view start_iso_month,
+                                            std::string_view end_iso_month)
+    -> RangeReportData {
+  return range_query_.read_range_data(start_iso_month, end_iso_month);
 }
 
 auto SqliteReportDataGateway::ListAvailableMonths() -> std::vector<std::string> {
   std::vector<std::string> months;
   const char* sql = "SELECT DISTINCT bill_date FROM bills ORDER BY bill_date;";
-  sqlite3_stmt* stmt = nullptr;
-
-  if (sqlite3_prepare_v2(db_connection_, sql, -1, &stmt, nullptr) !=
-      SQLITE_OK) {
-    throw std::runtime_error("Failed to prepare month list query: " +
-                             std::string(sqlite3_errmsg(db_connection_)));
-  }
+  const auto lease =
+      statements_.Acquire(sql, "Failed to prepare month list query: ");
+  sqlite3_stmt* stmt = lease.get();
 
   while (sqlite3_step(stmt) == SQLITE_ROW) {
     const auto* month_text =
@@ -48,7 +49,5 @@ auto SqliteReportDataGateway::ListAvailableMonths() -> std::vector<std::string>
       months.emplace_back(month_text);
     }
   }
-
-  sqlite3_finalize(stmt);
   return months;
 }
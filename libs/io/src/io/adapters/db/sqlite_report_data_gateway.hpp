@@ -8,6 +8,10 @@
 #include <string_view>
 #include <vector>
 
+#include "io/adapters/db/month_query.hpp"
+#include "io/adapters/db/range_query.hpp"
+#include "io/adapters/db/sqlite_statement_cache.hpp"
+#include "io/adapters/db/year_query.hpp"
 #include "ports/report_data_gateway.hpp"
 
 class SqliteReportDataGateway final : public ReportDataGateway {
@@ -18,10 +22,18 @@ class SqliteReportDataGateway final : public ReportDataGateway {
       -> MonthlyReportData override;
   [[nodiscard]] auto ReadYearlyData(std::string_view iso_year)
       -> YearlyReportData override;
+  [[nodiscard]] auto ReadRangeData(std::string_view start_iso_month,
+                                   std::string_view end_iso_month)
+      -> RangeReportData override;
   [[nodiscard]] auto ListAvailableMonths() -> std::vector<std::string> override;
 
  private:
+  // 语句缓存与会话连接同生命周期：批量导出时每条语句只准备一次。
   sqlite3* db_connection_ = nullptr;
+  SqliteStatementCache statements_;
+  MonthQuery month_query_;
+  YearQuery year_query_;
+  RangeQuery range_query_;
 };
 
 #endif  // BILLS_IO_ADAPTERS_DB_SQLITE_REPORT_DATA_GATEWAY_H_
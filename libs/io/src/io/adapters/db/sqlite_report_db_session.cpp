@@ -3,9 +3,19 @@
 
 #include <stdexcept>
 
+#include "io/adapters/db/sqlite_performance_profile.hpp"
+
 SqliteReportDbSession::SqliteReportDbSession(std::string db_path) {
   if (sqlite3_open_v2(db_path.c_str(), &db_connection_, SQLITE_OPEN_READONLY,
                       nullptr) == SQLITE_OK) {
+    try {
+      bills::io::ApplySqlitePerformanceProfile(
+          db_connection_, bills::io::GetSqlitePerformanceProfile(), false);
+    } catch (...) {
+      sqlite3_close(db_connection_);
+      db_connection_ = nullptr;
+      throw;
+    }
     return;
   }
 
@@ -0,0 +1,37 @@
+// io/adapters/db/sqlite_statement_cache.cpp
+#include "io/adapters/db/sqlite_statement_cache.hpp"
+
+#include <stdexcept>
+
+SqliteStatementCache::Lease::~Lease() {
+  sqlite3_reset(stmt_);
+  sqlite3_clear_bindings(stmt_);
+}
+
+SqliteStatementCache::SqliteStatementCache(sqlite3* db_connection)
+    : db_connection_(db_connection) {}
+
+SqliteStatementCache::~SqliteStatementCache() {
+  for (auto& [_, stmt] : statements_) {
+    sqlite3_finalize(stmt);
+  }
+}
+
+auto SqliteStatementCache::Acquire(std::string_view sql,
+                                   std::string_view failure_message) -> Lease {
+  auto found = statements_.find(sql);
+  if (found != statements_.end()) {
+    return Lease(found->second);
+  }
+
+  sqlite3_stmt* stmt = nullptr;
+  if (sqlite3_prepare_v2(db_connection_, sql.data(),
+                         static_cast<int>(sql.size()), &stmt,
+                         nullptr) != SQLITE_OK) {
+    sqlite3_finalize(stmt);
+    throw std::runtime_error(std::string(failure_message) +
+                             sqlite3_errmsg(db_connection_));
+  }
+  statements_.emplace(std::string(sql), stmt);
+  return Lease(stmt);
+}
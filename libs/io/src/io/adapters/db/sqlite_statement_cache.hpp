@@ -0,0 +1,66 @@
+// io/adapters/db/sqlite_statement_cache.hpp
+#ifndef BILLS_IO_ADAPTERS_DB_SQLITE_STATEMENT_CACHE_H_
+#define BILLS_IO_ADAPTERS_DB_SQLITE_STATEMENT_CACHE_H_
+
+#include <sqlite3.h>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @class SqliteStatementCache
+ * @brief 按 SQL 文本缓存预编译语句，连接存续期间每条语句只准备一次。
+ *
+ * 缓存不持有连接，必须在连接关闭之前析构。
+ */
+class SqliteStatementCache {
+ public:
+  /**
+   * @brief 借出的语句；离开作用域时 reset 并清空绑定，避免长期占用读事务。
+   */
+  class Lease {
+   public:
+    explicit Lease(sqlite3_stmt* stmt) : stmt_(stmt) {}
+    ~Lease();
+
+    Lease(const Lease&) = delete;
+    auto operator=(const Lease&) -> Lease& = delete;
+
+    [[nodiscard]] auto get() const -> sqlite3_stmt* { return stmt_; }
+
+   private:
+    sqlite3_stmt* stmt_;
+  };
+
+  explicit SqliteStatementCache(sqlite3* db_connection);
+  ~SqliteStatementCache();
+
+  SqliteStatementCache(const SqliteStatementCache&) = delete;
+  auto operator=(const SqliteStatementCache&) -> SqliteStatementCache& = delete;
+
+  /**
+   * @brief 取出 sql 对应的语句，首次使用时才准备。
+   * @param failure_message 准备失败时异常信息的前缀，后接 SQLite 错误信息。
+   * @throws std::runtime_error 如果语句准备失败。
+   */
+  [[nodiscard]] auto Acquire(std::string_view sql,
+                             std::string_view failure_message) -> Lease;
+
+ private:
+  // 支持以 string_view 直接查找，命中缓存时不分配内存。
+  struct SqlHash {
+    using is_transparent = void;
+    auto operator()(std::string_view sql) const -> std::size_t {
+      return std::hash<std::string_view>{}(sql);
+    }
+  };
+
+  sqlite3* db_connection_;
+  std::unordered_map<std::string, sqlite3_stmt*, SqlHash, std::equal_to<>>
+      statements_;
+};
+
+#endif  // BILLS_IO_ADAPTERS_DB_SQLITE_STATEMENT_CACHE_H_
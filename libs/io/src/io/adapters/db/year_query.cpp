@@ -7,6 +7,8 @@
 #include <stdexcept>
 #include <string>
 
+#include "io/adapters/db/sqlite_money_column.hpp"
+
 namespace {
 constexpr int kMinSupportedYear = 1900;
 constexpr int kMaxSupportedYear = 9999;
@@ -31,7 +33,8 @@ auto ParseIsoYear(std::string_view iso_year) -> int {
 }
 }  // namespace
 
-YearQuery::YearQuery(sqlite3* db_connection) : m_db(db_connection) {}
+YearQuery::YearQuery(SqliteStatementCache& statements)
+    : m_statements(statements) {}
 
 auto YearQuery::read_yearly_data(std::string_view iso_year) -> YearlyReportData {
   YearlyReportData data;
@@ -43,25 +46,22 @@ auto YearQuery::read_yearly_data(std::string_view iso_year) -> YearlyReportData
       "  SUM(total_income), "
       "  SUM(total_expense) "
       "FROM bills "
-      "WHERE substr(bill_date, 1, 4) = ? "
+      "WHERE year = ? "
       "GROUP BY month "
       "ORDER BY month;";
 
-  sqlite3_stmt* stmt = nullptr;
-
-  if (sqlite3_prepare_v2(m_db, sql, -1, &stmt, nullptr) != SQLITE_OK) {
-    throw std::runtime_error("准备年度查询的 SQL 语句失败: " +
-                             std::string(sqlite3_errmsg(m_db)));
-  }
+  const auto lease =
+      m_statements.Acquire(sql, "准备年度查询的 SQL 语句失败: ");
+  sqlite3_stmt* stmt = lease.get();
 
-  sqlite3_bind_text(stmt, 1, iso_year.data(),
-                    static_cast<int>(iso_year.size()), SQLITE_TRANSIENT);
+  sqlite3_bind_int(stmt, 1, data.year);
 
   while (sqlite3_step(stmt) == SQLITE_ROW) {
     data.data_found = true;
     int month = sqlite3_column_int(stmt, 0);
-    double month_income = sqlite3_column_double(stmt, 1);
-    double month_expense = sqlite3_column_double(stmt, 2);
+    // 金额列为整数分，SUM 在 SQLite 中按整数精确累加。
+    const Money month_income = ColumnMoney(stmt, 1);
+    const Money month_expense = ColumnMoney(stmt, 2);
 
     data.monthly_summary[month] = {.income = month_income,
                                    .expense = month_expense};
@@ -69,7 +69,6 @@ auto YearQuery::read_yearly_data(std::string_view iso_year) -> YearlyReportData
     data.total_income += month_income;
     data.total_expense += month_expense;
   }
-  sqlite3_finalize(stmt);
 
   if (data.data_found) {
     data.balance = data.total_income + data.total_expense;
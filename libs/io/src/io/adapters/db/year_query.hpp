@@ -6,17 +6,18 @@
 
 #include <string_view>
 
+#include "io/adapters/db/sqlite_statement_cache.hpp"
 #include "ports/contracts/reports/yearly/yearly_report_data.hpp"
 
 class YearQuery {
  public:
-  explicit YearQuery(sqlite3* db_connection);
+  explicit YearQuery(SqliteStatementCache& statements);
 
   // Reads yearly data and returns it in a dedicated structure.
   YearlyReportData read_yearly_data(std::string_view iso_year);
 
  private:
-  sqlite3* m_db;
+  SqliteStatementCache& m_statements;
 };
 
 #endif  // BILLS_IO_ADAPTERS_DB_YEAR_QUERY_H_
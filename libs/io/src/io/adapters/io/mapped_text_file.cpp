@@ -0,0 +1,133 @@
+#include "io/adapters/io/mapped_text_file.hpp"
+
+#include <utility>
+
+#include "io/adapters/io/source_document_io.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+auto MappedTextFile::Open(const std::filesystem::path& file_path)
+    -> Result<MappedTextFile> {
+  MappedTextFile file;
+  if (file.try_map(file_path)) {
+    return file;
+  }
+  auto text = SourceDocumentIo::ReadText(file_path);
+  if (!text) {
+    return std::unexpected(text.error());
+  }
+  file.fallback_text_ = std::move(*text);
+  return file;
+}
+
+MappedTextFile::~MappedTextFile() { release(); }
+
+MappedTextFile::MappedTextFile(MappedTextFile&& other) noexcept
+    : mapped_data_(std::exchange(other.mapped_data_, nullptr)),
+      mapped_size_(std::exchange(other.mapped_size_, 0U)),
+      fallback_text_(std::move(other.fallback_text_)) {}
+
+auto MappedTextFile::operator=(MappedTextFile&& other) noexcept
+    -> MappedTextFile& {
+  if (this != &other) {
+    release();
+    mapped_data_ = std::exchange(other.mapped_data_, nullptr);
+    mapped_size_ = std::exchange(other.mapped_size_, 0U);
+    fallback_text_ = std::move(other.fallback_text_);
+  }
+  return *this;
+}
+
+auto MappedTextFile::view() const -> std::string_view {
+  if (mapped_data_ != nullptr) {
+    return {mapped_data_, mapped_size_};
+  }
+  return fallback_text_;
+}
+
+auto MappedTextFile::is_mapped() const -> bool { return mapped_data_ != nullptr; }
+
+#ifdef _WIN32
+
+auto MappedTextFile::try_map(const std::filesystem::path& file_path) -> bool {
+  HANDLE file = CreateFileW(file_path.c_str(), GENERIC_READ,
+                            FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                            OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  LARGE_INTEGER file_size{};
+  if (GetFileSizeEx(file, &file_size) == 0 || file_size.QuadPart <= 0) {
+    CloseHandle(file);
+    return false;
+  }
+  HANDLE mapping =
+      CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (mapping == nullptr) {
+    return false;
+  }
+  // 视图持有映射对象的引用，句柄可以立即关闭。
+  const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (view == nullptr) {
+    return false;
+  }
+  mapped_data_ = static_cast<const char*>(view);
+  mapped_size_ = static_cast<std::size_t>(file_size.QuadPart);
+  return true;
+}
+
+void MappedTextFile::release() {
+  if (mapped_data_ != nullptr) {
+    UnmapViewOfFile(mapped_data_);
+    mapped_data_ = nullptr;
+    mapped_size_ = 0U;
+  }
+}
+
+#else
+
+auto MappedTextFile::try_map(const std::filesystem::path& file_path) -> bool {
+  const int fd = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat file_stat {};
+  if (::fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode) ||
+      file_stat.st_size <= 0) {
+    ::close(fd);
+    return false;
+  }
+  const auto size = static_cast<std::size_t>(file_stat.st_size);
+  void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // 映射建立后即可关闭描述符，映射本身保持文件引用。
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+  ::madvise(mapping, size, MADV_SEQUENTIAL);
+  // 提前发起异步预读：并发打开的文件在冷缓存下同时排队读取，
+  // 而不是等到解析时逐页缺页、串行等待磁盘。
+  ::madvise(mapping, size, MADV_WILLNEED);
+  mapped_data_ = static_cast<const char*>(mapping);
+  mapped_size_ = size;
+  return true;
+}
+
+void MappedTextFile::release() {
+  if (mapped_data_ != nullptr) {
+    ::munmap(const_cast<char*>(mapped_data_), mapped_size_);
+    mapped_data_ = nullptr;
+    mapped_size_ = 0U;
+  }
+}
+
+#endif
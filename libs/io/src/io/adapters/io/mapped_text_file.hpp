@@ -0,0 +1,40 @@
+#ifndef BILLS_IO_ADAPTERS_IO_MAPPED_TEXT_FILE_HPP_
+#define BILLS_IO_ADAPTERS_IO_MAPPED_TEXT_FILE_HPP_
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+#include "common/Result.hpp"
+
+// 只读映射的文本文件；内容以 string_view 暴露，不复制到堆上。
+// 无法映射时（空文件、非常规文件、平台不支持）回退为读入内存，调用方无需区分。
+// 映射期间源文件被其他进程截断属于未定义行为（POSIX 上会触发 SIGBUS）。
+class MappedTextFile {
+ public:
+  [[nodiscard]] static auto Open(const std::filesystem::path& file_path)
+      -> Result<MappedTextFile>;
+
+  MappedTextFile() = default;
+  ~MappedTextFile();
+
+  MappedTextFile(const MappedTextFile&) = delete;
+  auto operator=(const MappedTextFile&) -> MappedTextFile& = delete;
+  MappedTextFile(MappedTextFile&& other) noexcept;
+  auto operator=(MappedTextFile&& other) noexcept -> MappedTextFile&;
+
+  // 对象存续期间有效；回退模式下短文本存放在对象内部，移动对象后须重新取视图。
+  [[nodiscard]] auto view() const -> std::string_view;
+  [[nodiscard]] auto is_mapped() const -> bool;
+
+ private:
+  auto try_map(const std::filesystem::path& file_path) -> bool;
+  void release();
+
+  const char* mapped_data_ = nullptr;
+  std::size_t mapped_size_ = 0U;
+  std::string fallback_text_;
+};
+
+#endif  // BILLS_IO_ADAPTERS_IO_MAPPED_TEXT_FILE_HPP_
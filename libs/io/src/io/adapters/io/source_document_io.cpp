@@ -2,7 +2,12 @@
 
 #include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <sstream>
+#include <string>
+#include <utility>
+
+#include "common/parallel_for.hpp"
 
 namespace {
 constexpr const char* kContext = "SourceDocumentIo";
@@ -17,11 +22,29 @@ auto normalize_extension(std::string_view extension) -> std::string {
   return "." + std::string(extension);
 }
 
-template <typename DisplayPathBuilder>
-auto load_documents_by_extension(const std::filesystem::path& root_path,
-                                 std::string_view extension,
-                                 DisplayPathBuilder&& build_display_path)
-    -> Result<SourceDocumentBatch> {
+// 同时进行的目录遍历与文件读取上限：足以在冷缓存、机械盘或网络挂载目录上
+// 重叠 I/O 等待，又不会对同一块磁盘发起过多并发请求。
+constexpr std::size_t kMaxInFlightIo = 8U;
+
+// 递归收集 directory 下匹配扩展名的文件，不排序。
+auto walk_directory(const std::filesystem::path& directory,
+                    const std::string& normalized_extension)
+    -> std::vector<std::filesystem::path> {
+  std::vector<std::filesystem::path> files;
+  for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
+    if (entry.is_regular_file() && entry.path().extension() == normalized_extension) {
+      files.push_back(entry.path());
+    }
+  }
+  return files;
+}
+
+// 收集 root_path 下（或 root_path 本身）匹配扩展名的文件，按路径排序。
+// 目录的直接子目录（工作区中即年份目录）并行遍历，合并后统一排序，
+// 因此结果与串行遍历完全一致。
+auto collect_files_by_extension(const std::filesystem::path& root_path,
+                                std::string_view extension)
+    -> Result<std::vector<std::filesystem::path>> {
   const std::string normalized_extension = normalize_extension(extension);
   if (normalized_extension.empty()) {
     return std::unexpected(MakeError("File extension must not be empty.", kContext));
@@ -31,35 +54,15 @@ auto load_documents_by_extension(const std::filesystem::path& root_path,
         MakeError("Path does not exist: " + root_path.string(), kContext));
   }
 
-  SourceDocumentBatch documents;
-  auto append_file = [&documents, &build_display_path](
-                         const std::filesystem::path& file_path) -> Result<void> {
-    const auto text = SourceDocumentIo::ReadText(file_path);
-    if (!text) {
-      return std::unexpected(text.error());
-    }
-    const auto display_path = build_display_path(file_path);
-    if (!display_path) {
-      return std::unexpected(display_path.error());
-    }
-    documents.push_back(SourceDocument{
-        .display_path = *display_path,
-        .text = *text,
-    });
-    return {};
-  };
-
+  std::vector<std::filesystem::path> files;
   if (std::filesystem::is_regular_file(root_path)) {
     if (root_path.extension() != normalized_extension) {
       return std::unexpected(MakeError(
           "Provided file does not match extension " + normalized_extension + ".",
           kContext));
     }
-    const auto result = append_file(root_path);
-    if (!result) {
-      return std::unexpected(result.error());
-    }
-    return documents;
+    files.push_back(root_path);
+    return files;
   }
   if (!std::filesystem::is_directory(root_path)) {
     return std::unexpected(
@@ -67,23 +70,107 @@ auto load_documents_by_extension(const std::filesystem::path& root_path,
                   kContext));
   }
 
-  std::vector<std::filesystem::path> files;
-  for (const auto& entry : std::filesystem::recursive_directory_iterator(root_path)) {
-    if (entry.is_regular_file() && entry.path().extension() == normalized_extension) {
+  std::vector<std::filesystem::path> subdirectories;
+  for (const auto& entry : std::filesystem::directory_iterator(root_path)) {
+    // 与 recursive_directory_iterator 一致，不进入指向目录的符号链接。
+    if (entry.is_directory() && !entry.is_symlink()) {
+      subdirectories.push_back(entry.path());
+    } else if (entry.is_regular_file() &&
+               entry.path().extension() == normalized_extension) {
       files.push_back(entry.path());
     }
   }
+
+  std::vector<std::vector<std::filesystem::path>> nested_files(
+      subdirectories.size());
+  bills::core::common::ParallelForEachIndex(
+      subdirectories.size(), kMaxInFlightIo, [&](std::size_t index) {
+        nested_files[index] =
+            walk_directory(subdirectories[index], normalized_extension);
+      });
+  for (auto& nested : nested_files) {
+    files.insert(files.end(), std::make_move_iterator(nested.begin()),
+                 std::make_move_iterator(nested.end()));
+  }
   std::sort(files.begin(), files.end());
-  for (const auto& file_path : files) {
-    const auto result = append_file(file_path);
-    if (!result) {
-      return std::unexpected(result.error());
+  return files;
+}
+
+// 并发读取 files，最多 kMaxInFlightIo 个读取同时进行；结果与 files 一一对应。
+// 多个文件失败时返回下标最小的错误，与串行读取最先遇到的错误一致。
+auto read_files(const std::vector<std::filesystem::path>& files)
+    -> Result<std::vector<std::string>> {
+  std::vector<Result<std::string>> texts(files.size());
+  bills::core::common::ParallelForEachIndex(
+      files.size(), kMaxInFlightIo, [&](std::size_t index) {
+        texts[index] = SourceDocumentIo::ReadText(files[index]);
+      });
+
+  std::vector<std::string> contents;
+  contents.reserve(texts.size());
+  for (auto& text : texts) {
+    if (!text) {
+      return std::unexpected(std::move(text.error()));
+    }
+    contents.push_back(std::move(*text));
+  }
+  return contents;
+}
+
+// 扫描根为单个文件时返回文件名，否则返回相对 normalized_root 的路径。
+auto build_relative_path(const std::filesystem::path& normalized_root,
+                         bool root_is_file,
+                         const std::filesystem::path& file_path)
+    -> Result<std::string> {
+  if (root_is_file) {
+    return file_path.filename().generic_string();
+  }
+  const std::filesystem::path relative_path =
+      file_path.lexically_relative(normalized_root);
+  if (relative_path.empty() || relative_path == ".") {
+    return std::unexpected(MakeError(
+        "Failed to resolve relative path for: " + file_path.string(), kContext));
+  }
+  return relative_path.generic_string();
+}
+
+template <typename DisplayPathBuilder>
+auto load_documents_by_extension(const std::filesystem::path& root_path,
+                                 std::string_view extension,
+                                 DisplayPathBuilder&& build_display_path)
+    -> Result<SourceDocumentBatch> {
+  const auto files = collect_files_by_extension(root_path, extension);
+  if (!files) {
+    return std::unexpected(files.error());
+  }
+
+  auto texts = read_files(*files);
+  if (!texts) {
+    return std::unexpected(texts.error());
+  }
+
+  SourceDocumentBatch documents;
+  documents.reserve(files->size());
+  for (std::size_t index = 0; index < files->size(); ++index) {
+    auto display_path = build_display_path((*files)[index]);
+    if (!display_path) {
+      return std::unexpected(display_path.error());
     }
+    documents.push_back(SourceDocument{
+        .display_path = std::move(*display_path),
+        .text = std::move((*texts)[index]),
+    });
   }
   return documents;
 }
 }  // namespace
 
+auto SourceDocumentIo::ListByExtension(const std::filesystem::path& root_path,
+                                       std::string_view extension)
+    -> Result<std::vector<std::filesystem::path>> {
+  return collect_files_by_extension(root_path, extension);
+}
+
 auto SourceDocumentIo::LoadByExtension(const std::filesystem::path& root_path,
                                        std::string_view extension)
     -> Result<SourceDocumentBatch> {
@@ -94,27 +181,88 @@ auto SourceDocumentIo::LoadByExtension(const std::filesystem::path& root_path,
       });
 }
 
+auto SourceDocumentIo::MapByExtension(const std::filesystem::path& root_path,
+                                      std::string_view extension)
+    -> Result<MappedSourceDocumentBatch> {
+  const auto files = collect_files_by_extension(root_path, extension);
+  if (!files) {
+    return std::unexpected(files.error());
+  }
+
+  // 打开与映射同样并发进行，网络挂载目录上每次 open 都是一次往返。
+  std::vector<Result<MappedTextFile>> opened(files->size());
+  bills::core::common::ParallelForEachIndex(
+      files->size(), kMaxInFlightIo, [&](std::size_t index) {
+        opened[index] = MappedTextFile::Open((*files)[index]);
+      });
+
+  MappedSourceDocumentBatch batch;
+  // 预留容量保证 files 不会重新分配，回退模式下的视图因此保持有效。
+  batch.files.reserve(files->size());
+  batch.documents.reserve(files->size());
+  for (std::size_t index = 0; index < files->size(); ++index) {
+    auto& mapped = opened[index];
+    if (!mapped) {
+      return std::unexpected(std::move(mapped.error()));
+    }
+    // 视图须在对象放入 batch.files 之后获取。
+    const auto& file = batch.files.emplace_back(std::move(*mapped));
+    batch.documents.push_back(SourceDocumentRef{
+        .display_path = (*files)[index].string(),
+        .text = file.view(),
+    });
+  }
+  return batch;
+}
+
 auto SourceDocumentIo::LoadByExtensionRelative(
     const std::filesystem::path& root_path, std::string_view extension)
     -> Result<SourceDocumentBatch> {
   const std::filesystem::path normalized_root = root_path.lexically_normal();
+  const bool root_is_file = std::filesystem::is_regular_file(normalized_root);
   return load_documents_by_extension(
       normalized_root, extension,
-      [normalized_root](const std::filesystem::path& file_path) -> Result<std::string> {
-        if (std::filesystem::is_regular_file(normalized_root)) {
-          return file_path.filename().generic_string();
-        }
-        const std::filesystem::path relative_path =
-            file_path.lexically_relative(normalized_root);
-        if (relative_path.empty() || relative_path == ".") {
-          return std::unexpected(MakeError(
-              "Failed to resolve relative path for: " + file_path.string(),
-              kContext));
-        }
-        return relative_path.generic_string();
+      [&normalized_root,
+       root_is_file](const std::filesystem::path& file_path) -> Result<std::string> {
+        return build_relative_path(normalized_root, root_is_file, file_path);
       });
 }
 
+auto SourceDocumentIo::ScanByExtension(const std::filesystem::path& root_path,
+                                       std::string_view extension)
+    -> Result<ScannedSourceDocumentBatch> {
+  const auto files = collect_files_by_extension(root_path, extension);
+  if (!files) {
+    return std::unexpected(files.error());
+  }
+
+  const std::filesystem::path normalized_root = root_path.lexically_normal();
+  const bool root_is_file = std::filesystem::is_regular_file(normalized_root);
+  ScannedSourceDocumentBatch batch;
+  batch.documents.reserve(files->size());
+  batch.relative_paths.reserve(files->size());
+  for (const auto& file_path : *files) {
+    auto relative_path =
+        build_relative_path(normalized_root, root_is_file,
+                            file_path.lexically_normal());
+    if (!relative_path) {
+      return std::unexpected(relative_path.error());
+    }
+    batch.relative_paths.push_back(std::move(*relative_path));
+  }
+  auto texts = read_files(*files);
+  if (!texts) {
+    return std::unexpected(texts.error());
+  }
+  for (std::size_t index = 0; index < files->size(); ++index) {
+    batch.documents.push_back(SourceDocument{
+        .display_path = (*files)[index].string(),
+        .text = std::move((*texts)[index]),
+    });
+  }
+  return batch;
+}
+
 auto SourceDocumentIo::ReadText(const std::filesystem::path& file_path)
     -> Result<std::string> {
   std::ifstream input(file_path, std::ios::binary);
@@ -122,9 +270,35 @@ auto SourceDocumentIo::ReadText(const std::filesystem::path& file_path)
     return std::unexpected(
         MakeError("Failed to open file: " + file_path.string(), kContext));
   }
-  std::ostringstream buffer;
-  buffer << input.rdbuf();
-  return buffer.str();
+  // 按文件大小一次读入目标字符串，避免经由 ostringstream 的额外复制；
+  // 无法定位到末尾的伪文件（如 /proc）重新打开后按流读取。
+  input.seekg(0, std::ios::end);
+  const std::streamoff size = input.tellg();
+  if (size < 0) {
+    input.close();
+    input.open(file_path, std::ios::binary);
+    std::ostringstream buffer;
+    buffer << input.rdbuf();
+    return std::move(buffer).str();
+  }
+  input.seekg(0, std::ios::beg);
+  std::string text;
+  if (size > 0) {
+    text.resize(static_cast<std::size_t>(size));
+    input.read(text.data(), static_cast<std::streamsize>(size));
+    text.resize(static_cast<std::size_t>(input.gcount()));
+  }
+  // 读取期间变长的文件继续读到末尾。
+  if (input.peek() != std::char_traits<char>::eof()) {
+    std::ostringstream rest;
+    rest << input.rdbuf();
+    text += std::move(rest).str();
+  }
+  if (input.bad()) {
+    return std::unexpected(
+        MakeError("Failed to read file: " + file_path.string(), kContext));
+  }
+  return text;
 }
 
 auto SourceDocumentIo::WriteText(const std::filesystem::path& file_path,
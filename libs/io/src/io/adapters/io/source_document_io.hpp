@@ -2,22 +2,54 @@
 #define BILLS_IO_ADAPTERS_IO_SOURCE_DOCUMENT_IO_HPP_
 
 #include <filesystem>
+#include <string>
 #include <string_view>
 #include <vector>
 
 #include "common/Result.hpp"
 #include "common/source_document.hpp"
+#include "io/adapters/io/mapped_text_file.hpp"
+
+// 内存映射读取的批次：documents 中的 text 指向 files 持有的映射，二者须一同存活。
+// 整体移动批次不会使视图失效。
+struct MappedSourceDocumentBatch {
+  std::vector<MappedTextFile> files;
+  SourceDocumentRefBatch documents;
+};
+
+// 一次目录遍历、一次读取得到的批次：documents 的 display_path 与 LoadByExtension
+// 相同，relative_paths[i] 是 documents[i] 相对扫描根目录的路径。
+struct ScannedSourceDocumentBatch {
+  SourceDocumentBatch documents;
+  std::vector<std::string> relative_paths;
+};
 
 class SourceDocumentIo {
  public:
+  // 只列出匹配扩展名的文件路径（按路径排序），不读取内容。
+  [[nodiscard]] static auto ListByExtension(const std::filesystem::path& root_path,
+                                            std::string_view extension)
+      -> Result<std::vector<std::filesystem::path>>;
+
   [[nodiscard]] static auto LoadByExtension(const std::filesystem::path& root_path,
                                             std::string_view extension)
       -> Result<SourceDocumentBatch>;
 
+  // 与 LoadByExtension 相同的文件集合与 display_path，但不复制文件内容。
+  [[nodiscard]] static auto MapByExtension(const std::filesystem::path& root_path,
+                                           std::string_view extension)
+      -> Result<MappedSourceDocumentBatch>;
+
   [[nodiscard]] static auto LoadByExtensionRelative(
       const std::filesystem::path& root_path, std::string_view extension)
       -> Result<SourceDocumentBatch>;
 
+  // 同时给出原始路径与相对路径，替代分别调用 LoadByExtension 和
+  // LoadByExtensionRelative 造成的重复遍历与重复读取。
+  [[nodiscard]] static auto ScanByExtension(const std::filesystem::path& root_path,
+                                            std::string_view extension)
+      -> Result<ScannedSourceDocumentBatch>;
+
   [[nodiscard]] static auto ReadText(const std::filesystem::path& file_path)
       -> Result<std::string>;
 
@@ -0,0 +1,195 @@
+#include "io/adapters/reports/report_export_manifest.hpp"
+
+#include <array>
+#include <bit>
+#include <charconv>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "common/version.hpp"
+
+namespace {
+namespace fs = std::filesystem;
+
+constexpr std::string_view kManifestHeader = "bills-report-export-manifest\t1";
+
+// 按字段逐个累加的 FNV-1a；字符串带长度前缀，避免相邻字段拼接后产生歧义。
+class ReportHasher {
+ public:
+  void Add(std::string_view text) {
+    Add(static_cast<std::uint64_t>(text.size()));
+    AddBytes(text.data(), text.size());
+  }
+
+  void Add(std::uint64_t value) { AddBytes(&value, sizeof(value)); }
+
+  void Add(int value) { Add(static_cast<std::uint64_t>(value)); }
+
+  void Add(bool value) { Add(static_cast<std::uint64_t>(value ? 1U : 0U)); }
+
+  // 直接取位模式：数值的任何变化都会让指纹失效，宁可多渲染一次。
+  void Add(double value) { Add(std::bit_cast<std::uint64_t>(value)); }
+
+  [[nodiscard]] auto Digest() const -> std::string {
+    constexpr std::size_t kHexDigits = 16U;
+    std::array<char, kHexDigits> buffer{};
+    char* end =
+        std::to_chars(buffer.data(), buffer.data() + buffer.size(), hash_, 16)
+            .ptr;
+    std::string digest(
+        kHexDigits - static_cast<std::size_t>(end - buffer.data()), '0');
+    digest.append(buffer.data(), end);
+    return digest;
+  }
+
+ private:
+  static constexpr std::uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+  static constexpr std::uint64_t kFnvPrime = 1099511628211ULL;
+
+  void AddBytes(const void* data, std::size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t index = 0U; index < size; ++index) {
+      hash_ ^= bytes[index];
+      hash_ *= kFnvPrime;
+    }
+  }
+
+  std::uint64_t hash_ = kFnvOffsetBasis;
+};
+
+// 词条编号只在本次进程的词表内有效，指纹按文本计算。
+void AddTerm(ReportHasher& hasher, const BillVocabulary& vocabulary,
+             VocabularyId id) {
+  hasher.Add(std::string_view(vocabulary.Text(id)));
+}
+
+}  // namespace
+
+auto FingerprintStandardReport(const StandardReport& report,
+                               std::string_view format_name) -> std::string {
+  ReportHasher hasher;
+  hasher.Add(bills::core::version::kVersion);
+  hasher.Add(format_name);
+  hasher.Add(std::string_view(report.schema_version));
+  hasher.Add(std::string_view(report.report_type));
+  hasher.Add(std::string_view(report.source));
+  hasher.Add(std::string_view(report.period_start));
+  hasher.Add(std::string_view(report.period_end));
+  hasher.Add(std::string_view(report.remark));
+  hasher.Add(report.data_found);
+  hasher.Add(report.total_income);
+  hasher.Add(report.total_expense);
+  hasher.Add(report.balance);
+
+  hasher.Add(static_cast<std::uint64_t>(report.categories.size()));
+  for (const auto& category : report.categories) {
+    hasher.Add(std::string_view(category.name));
+    hasher.Add(category.total);
+    hasher.Add(static_cast<std::uint64_t>(category.sub_categories.size()));
+    for (const auto& sub_category : category.sub_categories) {
+      hasher.Add(std::string_view(sub_category.name));
+      hasher.Add(sub_category.subtotal);
+      hasher.Add(static_cast<std::uint64_t>(sub_category.transactions.size()));
+      for (const auto& transaction : sub_category.transactions) {
+        const BillVocabulary& vocabulary = *report.vocabulary;
+        AddTerm(hasher, vocabulary, transaction.parent_category);
+        AddTerm(hasher, vocabulary, transaction.sub_category);
+        AddTerm(hasher, vocabulary, transaction.transaction_type);
+        hasher.Add(std::string_view(transaction.description));
+        AddTerm(hasher, vocabulary, transaction.source);
+        hasher.Add(std::string_view(transaction.comment));
+        hasher.Add(transaction.amount);
+      }
+    }
+  }
+
+  hasher.Add(static_cast<std::uint64_t>(report.monthly_summary.size()));
+  for (const auto& month_item : report.monthly_summary) {
+    hasher.Add(month_item.year);
+    hasher.Add(month_item.month);
+    hasher.Add(month_item.income);
+    hasher.Add(month_item.expense);
+    hasher.Add(month_item.balance);
+  }
+  return hasher.Digest();
+}
+
+auto ReportExportManifest::Load(const fs::path& export_dir)
+    -> ReportExportManifest {
+  ReportExportManifest manifest;
+  std::ifstream input(export_dir / kFileName, std::ios::binary);
+  if (!input) {
+    return manifest;
+  }
+  std::string line;
+  if (!std::getline(input, line) || line != kManifestHeader) {
+    return manifest;
+  }
+  while (std::getline(input, line)) {
+    const std::size_t first_tab = line.find('\t');
+    const std::size_t second_tab =
+        first_tab == std::string::npos ? std::string::npos
+                                       : line.find('\t', first_tab + 1U);
+    if (second_tab == std::string::npos) {
+      return {};
+    }
+    ReportExportManifestEntry entry{.fingerprint = line.substr(0U, first_tab)};
+    const char* size_begin = line.data() + first_tab + 1U;
+    const char* size_end = line.data() + second_tab;
+    const auto [ptr, error] = std::from_chars(size_begin, size_end, entry.size);
+    if (error != std::errc{} || ptr != size_end) {
+      return {};
+    }
+    manifest.entries_.insert_or_assign(line.substr(second_tab + 1U),
+                                       std::move(entry));
+  }
+  return manifest;
+}
+
+auto ReportExportManifest::Save(const fs::path& export_dir) const -> bool {
+  std::error_code error;
+  fs::create_directories(export_dir, error);
+  if (error) {
+    return false;
+  }
+  const fs::path manifest_path = export_dir / kFileName;
+  fs::path temp_path = manifest_path;
+  temp_path += ".tmp";
+  {
+    std::ofstream output(temp_path, std::ios::binary | std::ios::trunc);
+    if (!output) {
+      return false;
+    }
+    output << kManifestHeader << '\n';
+    for (const auto& [relative_path, entry] : entries_) {
+      output << entry.fingerprint << '\t' << entry.size << '\t' << relative_path
+             << '\n';
+    }
+    if (!output.good()) {
+      return false;
+    }
+  }
+  fs::rename(temp_path, manifest_path, error);
+  if (error) {
+    fs::remove(temp_path, error);
+    return false;
+  }
+  return true;
+}
+
+auto ReportExportManifest::Find(const std::string& relative_path) const
+    -> const ReportExportManifestEntry* {
+  const auto entry = entries_.find(relative_path);
+  return entry == entries_.end() ? nullptr : &entry->second;
+}
+
+void ReportExportManifest::Set(const std::string& relative_path,
+                               ReportExportManifestEntry entry) {
+  entries_.insert_or_assign(relative_path, std::move(entry));
+}
+
+void ReportExportManifest::Erase(const std::string& relative_path) {
+  entries_.erase(relative_path);
+}
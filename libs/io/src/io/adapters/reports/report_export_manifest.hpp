@@ -0,0 +1,63 @@
+// io/adapters/reports/report_export_manifest.hpp
+
+#ifndef BILLS_IO_ADAPTERS_REPORTS_REPORT_EXPORT_MANIFEST_HPP_
+#define BILLS_IO_ADAPTERS_REPORTS_REPORT_EXPORT_MANIFEST_HPP_
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <string_view>
+
+#include "reporting/standard_report/standard_report_dto.hpp"
+
+// 清单中一份导出文件的记录：生成它的报表指纹及写出时的字节数。
+struct ReportExportManifestEntry {
+  std::string fingerprint;
+  std::uintmax_t size = 0U;
+};
+
+/**
+ * @brief 计算报表内容指纹，忽略 generated_at_utc 等每次导出都会变化的元数据。
+ *
+ * 指纹同时覆盖渲染格式与程序版本，格式或渲染器变化时输出会被视为已过期。
+ */
+[[nodiscard]] auto FingerprintStandardReport(const StandardReport& report,
+                                             std::string_view format_name)
+    -> std::string;
+
+/**
+ * @class ReportExportManifest
+ * @brief 导出目录下的旁路清单，记录每个导出文件由哪份报表内容生成。
+ *
+ * 增量导出据此跳过内容未变的账期，不重新渲染也不改写文件，
+ * 使下游按修改时间判断的 PDF 编译只处理真正变化的报表。
+ */
+class ReportExportManifest {
+ public:
+  static constexpr std::string_view kFileName = ".bills_export_manifest";
+
+  /**
+   * @brief 读取 export_dir 下的清单；文件缺失或格式不符时返回空清单，
+   *        此时所有文件都会被视为需要重新导出。
+   */
+  [[nodiscard]] static auto Load(const std::filesystem::path& export_dir)
+      -> ReportExportManifest;
+
+  /**
+   * @brief 先写临时文件再替换，避免中断时留下半份清单。
+   * @return 写入失败时返回 false；下次导出只会多渲染一次，不影响正确性。
+   */
+  [[nodiscard]] auto Save(const std::filesystem::path& export_dir) const -> bool;
+
+  // relative_path 为相对 export_dir 的 '/' 分隔路径。
+  [[nodiscard]] auto Find(const std::string& relative_path) const
+      -> const ReportExportManifestEntry*;
+  void Set(const std::string& relative_path, ReportExportManifestEntry entry);
+  void Erase(const std::string& relative_path);
+
+ private:
+  std::map<std::string, ReportExportManifestEntry> entries_;
+};
+
+#endif  // BILLS_IO_ADAPTERS_REPORTS_REPORT_EXPORT_MANIFEST_HPP_
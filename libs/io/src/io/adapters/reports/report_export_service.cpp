@@ -1,14 +1,25 @@
 #include "io/adapters/reports/report_export_service.hpp"
 
-#include <optional>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "common/iso_period.hpp"
+#include "common/parallel_for.hpp"
+#include "io/adapters/reports/report_export_manifest.hpp"
+#include "reporting/renderers/report_output_sink.hpp"
 #include "ports/report_data_gateway.hpp"
 #include "query/query_service.hpp"
 #include "reporting/renderers/standard_report_renderer_registry.hpp"
@@ -17,6 +28,9 @@
 namespace {
 namespace fs = std::filesystem;
 
+// 一次查询并保留在内存中的账期数；渲染完一个窗口即释放其报表。
+constexpr std::size_t kPeriodWindowSize = 32U;
+
 auto extension_for_format(const std::string& format_name) -> std::string {
   if (format_name == "json") {
     return ".json";
@@ -32,6 +46,137 @@ auto resolve_folder_name(
                                                 : folder_it->second;
 }
 
+struct ReportDestination {
+  std::string folder_name;
+  std::string extension;
+  bool is_standard_json = false;
+};
+
+// 渲染后待写入清单的记录；written 由写线程填写，写成功才记入清单。
+struct PendingManifestEntry {
+  std::string relative_path;
+  ReportExportManifestEntry entry;
+  const char* written = nullptr;
+};
+
+auto group_name_for(const ReportExportPeriod& period) -> std::string {
+  if (period.kind == ReportExportPeriodKind::kYear) {
+    return "years";
+  }
+  return "months/" + std::to_string(period.year);
+}
+
+void append_month_period(ReportExportPlan& plan, const ReportExportMonth& month) {
+  plan.periods.push_back({
+      .kind = ReportExportPeriodKind::kMonth,
+      .iso_period = month.iso_month,
+      .year = month.year,
+  });
+}
+
+// 渲染结果按块保存：渲染器写满一块就交出一块，写线程再逐块落盘，
+// 全程不会拼出一份完整的文档字符串。
+class ChunkedReportContent final : public ReportOutputSink {
+ public:
+  void Write(std::string_view chunk) override {
+    chunks_.emplace_back(chunk);
+    size_ += chunk.size();
+  }
+
+  [[nodiscard]] auto chunks() const -> const std::vector<std::string>& {
+    return chunks_;
+  }
+  [[nodiscard]] auto size() const -> std::size_t { return size_; }
+
+ private:
+  std::vector<std::string> chunks_;
+  std::size_t size_ = 0U;
+};
+
+auto write_text_file(const fs::path& output_path,
+                     const ChunkedReportContent& content) -> bool {
+  std::error_code create_error;
+  fs::create_directories(output_path.parent_path(), create_error);
+  if (create_error) {
+    return false;
+  }
+  std::ofstream output(output_path, std::ios::binary);
+  if (!output) {
+    return false;
+  }
+  for (const auto& chunk : content.chunks()) {
+    output.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+  }
+  return output.good();
+}
+
+// 单线程写出队列：渲染线程提交已渲染好的内容，写线程按提交顺序落盘，
+// 使磁盘写入与后续账期的渲染重叠。队列有上限，写盘落后时渲染线程等待，
+// 避免把整批报表同时留在内存里。
+class ReportWriteQueue {
+ public:
+  struct Item {
+    fs::path output_path;
+    std::shared_ptr<const ChunkedReportContent> content;
+    // 写入结果，只由写线程修改；close_and_wait() 返回后调用方才读取。
+    char* written = nullptr;
+  };
+
+  ReportWriteQueue() : worker_([this]() { run(); }) {}
+
+  ReportWriteQueue(const ReportWriteQueue&) = delete;
+  auto operator=(const ReportWriteQueue&) -> ReportWriteQueue& = delete;
+
+  ~ReportWriteQueue() { close_and_wait(); }
+
+  void push(Item item) {
+    std::unique_lock lock(mutex_);
+    space_available_.wait(lock,
+                          [this]() { return items_.size() < kMaxPendingWrites; });
+    items_.push_back(std::move(item));
+    item_available_.notify_one();
+  }
+
+  void close_and_wait() {
+    {
+      const std::lock_guard lock(mutex_);
+      closed_ = true;
+    }
+    item_available_.notify_one();
+    if (worker_.joinable()) {
+      worker_.join();
+    }
+  }
+
+ private:
+  static constexpr std::size_t kMaxPendingWrites = 64U;
+
+  void run() {
+    while (true) {
+      Item item;
+      {
+        std::unique_lock lock(mutex_);
+        item_available_.wait(lock,
+                             [this]() { return closed_ || !items_.empty(); });
+        if (items_.empty()) {
+          return;
+        }
+        item = std::move(items_.front());
+        items_.pop_front();
+      }
+      space_available_.notify_one();
+      *item.written = write_text_file(item.output_path, *item.content) ? 1 : 0;
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable item_available_;
+  std::condition_variable space_available_;
+  std::deque<Item> items_;
+  bool closed_ = false;
+  std::thread worker_;
+};
+
 }  // namespace
 
 auto TryBuildReportExportYear(std::string_view raw)
@@ -90,163 +235,337 @@ auto ReportExportService::list_normalized_available_months() const
   return result;
 }
 
-auto ReportExportService::write_report(const std::string& folder_name,
-                                       const std::string& group_name,
-                                       const std::string& stem,
-                                       const std::string& extension,
-                                       const std::string& content) const -> bool {
-  const fs::path output_path =
-      fs::path(export_base_dir_) / folder_name / group_name / (stem + extension);
-  std::error_code create_error;
-  fs::create_directories(output_path.parent_path(), create_error);
-  if (create_error) {
-    return false;
-  }
-  std::ofstream output(output_path, std::ios::binary);
-  if (!output) {
-    return false;
-  }
-  output << content;
-  return output.good();
+auto ReportExportService::plan_yearly_report(const ReportExportYear& year) const
+    -> ReportExportPlan {
+  ReportExportPlan plan;
+  plan.periods.push_back({
+      .kind = ReportExportPeriodKind::kYear,
+      .iso_period = year.iso_year,
+      .year = year.year,
+  });
+  return plan;
 }
 
-auto ReportExportService::write_standard_json(const std::string& group_name,
-                                              const std::string& stem,
-                                              const std::string& content) const
-    -> bool {
-  return write_report("standard_json", group_name, stem, ".json", content);
+auto ReportExportService::plan_monthly_report(const ReportExportMonth& month) const
+    -> ReportExportPlan {
+  ReportExportPlan plan;
+  plan.periods.push_back({
+      .kind = ReportExportPeriodKind::kMonth,
+      .iso_period = month.iso_month,
+      .year = month.year,
+  });
+  return plan;
 }
 
-auto ReportExportService::export_yearly_report(const ReportExportYear& year,
-                                               const std::string& format_name)
-    -> ReportExportRunResult {
-  const std::string normalized_format =
-      StandardReportRendererRegistry::NormalizeFormat(format_name);
-  if (normalized_format.empty()) {
-    return {.ok = false};
+auto ReportExportService::plan_monthly_range(const ReportExportRange& range) const
+    -> ReportExportPlan {
+  const auto normalized_months = list_normalized_available_months();
+  const int start_key = ReportExportMonthKey(range.start);
+  const int end_key = ReportExportMonthKey(range.end);
+  ReportExportPlan plan;
+  plan.had_invalid_entries = normalized_months.had_invalid_entries;
+  for (const auto& month : normalized_months.months) {
+    const int current_key = ReportExportMonthKey(month);
+    if (current_key >= start_key && current_key <= end_key) {
+      append_month_period(plan, month);
+    }
   }
+  return plan;
+}
 
-  const auto query_result =
-      QueryService::QueryYear(*report_data_gateway_, year.iso_year);
-  if (!query_result.data_found) {
-    return {.ok = false};
+auto ReportExportService::plan_all_monthly_reports() const -> ReportExportPlan {
+  const auto normalized_months = list_normalized_available_months();
+  ReportExportPlan plan;
+  plan.had_invalid_entries = normalized_months.had_invalid_entries;
+  for (const auto& month : normalized_months.months) {
+    append_month_period(plan, month);
   }
+  return plan;
+}
 
-  const auto standard_report = ReportRenderService::BuildStandardReport(query_result);
-  if (StandardReportRendererRegistry::IsFormatAvailable("json")) {
-    if (!write_standard_json("years", year.iso_year,
-                             ReportRenderService::Render(standard_report, "json"))) {
-      return {.ok = false};
-    }
+auto ReportExportService::plan_all_yearly_reports() const -> ReportExportPlan {
+  std::set<int> years;
+  const auto normalized_months = list_normalized_available_months();
+  ReportExportPlan plan;
+  plan.had_invalid_entries = normalized_months.had_invalid_entries;
+  for (const auto& month : normalized_months.months) {
+    years.insert(month.year);
   }
-  const std::string report = ReportRenderService::Render(standard_report, normalized_format);
-  if (!write_report(resolve_folder_name(format_folder_names_, normalized_format),
-                    "years", year.iso_year,
-                    extension_for_format(normalized_format), report)) {
-    return {.ok = false};
+  for (const int year : years) {
+    plan.periods.push_back({
+        .kind = ReportExportPeriodKind::kYear,
+        .iso_period = std::to_string(year),
+        .year = year,
+    });
   }
-  return {.ok = true, .exported_count = 1U};
+  return plan;
 }
 
-auto ReportExportService::export_monthly_report(const ReportExportMonth& month,
-                                                const std::string& format_name)
-    -> ReportExportRunResult {
-  const std::string normalized_format =
-      StandardReportRendererRegistry::NormalizeFormat(format_name);
-  if (normalized_format.empty()) {
-    return {.ok = false};
+auto ReportExportService::plan_all_reports() const -> ReportExportPlan {
+  auto plan = plan_all_monthly_reports();
+  auto yearly_plan = plan_all_yearly_reports();
+  plan.had_invalid_entries =
+      plan.had_invalid_entries || yearly_plan.had_invalid_entries;
+  plan.periods.insert(plan.periods.end(),
+                      std::make_move_iterator(yearly_plan.periods.begin()),
+                      std::make_move_iterator(yearly_plan.periods.end()));
+  return plan;
+}
+
+auto ReportExportService::export_plan(const ReportExportPlan& plan,
+                                      const std::vector<std::string>& format_names,
+                                      std::size_t jobs, bool incremental)
+    -> std::vector<ReportExportRunResult> {
+  std::vector<ReportExportRunResult> results(
+      format_names.size(), ReportExportRunResult{
+                               .ok = !plan.had_invalid_entries,
+                               .exported_count = 0U,
+                           });
+
+  // 每种格式只渲染一次：同名格式去重，json 可用时总会渲染一份，
+  // 同时供 standard_json 与 json 格式目录使用。
+  std::vector<std::string> render_formats;
+  std::vector<std::vector<ReportDestination>> render_destinations;
+  const auto render_slot_of = [&](const std::string& format) -> std::size_t {
+    for (std::size_t slot = 0U; slot < render_formats.size(); ++slot) {
+      if (render_formats[slot] == format) {
+        return slot;
+      }
+    }
+    render_formats.push_back(format);
+    render_destinations.emplace_back();
+    return render_formats.size() - 1U;
+  };
+
+  const bool standard_json_enabled =
+      StandardReportRendererRegistry::IsFormatAvailable("json");
+  std::optional<std::size_t> standard_json_slot;
+  if (standard_json_enabled) {
+    standard_json_slot = render_slot_of("json");
+    render_destinations[*standard_json_slot].push_back({
+        .folder_name = "standard_json",
+        .extension = ".json",
+        .is_standard_json = true,
+    });
+  }
+
+  std::vector<std::optional<std::size_t>> format_slots(format_names.size());
+  for (std::size_t index = 0U; index < format_names.size(); ++index) {
+    const std::string normalized_format =
+        StandardReportRendererRegistry::NormalizeFormat(format_names[index]);
+    if (normalized_format.empty() ||
+        !StandardReportRendererRegistry::IsFormatAvailable(normalized_format)) {
+      results[index].ok = false;
+      continue;
+    }
+    const std::size_t slot = render_slot_of(normalized_format);
+    format_slots[index] = slot;
+    auto& destinations = render_destinations[slot];
+    const bool has_format_destination =
+        std::ranges::any_of(destinations, [](const ReportDestination& item) {
+          return !item.is_standard_json;
+        });
+    if (!has_format_destination) {
+      destinations.push_back({
+          .folder_name =
+              resolve_folder_name(format_folder_names_, normalized_format),
+          .extension = extension_for_format(normalized_format),
+          .is_standard_json = false,
+      });
+    }
   }
 
-  const auto query_result =
-      QueryService::QueryMonth(*report_data_gateway_, month.iso_month);
-  if (!query_result.data_found) {
-    return {.ok = false};
+  // 清单总是随导出更新；只有增量模式才据此跳过内容未变的账期。
+  const fs::path export_base_dir(export_base_dir_);
+  auto manifest = ReportExportManifest::Load(export_base_dir);
+  const auto is_up_to_date = [&](const std::string& relative_path,
+                                 const std::string& fingerprint) -> bool {
+    const auto* entry = manifest.Find(relative_path);
+    if (entry == nullptr || entry->fingerprint != fingerprint) {
+      return false;
+    }
+    std::error_code size_error;
+    const auto size = fs::file_size(export_base_dir / relative_path, size_error);
+    return !size_error && size == entry->size;
+  };
+
+  const std::size_t period_count = plan.periods.size();
+  const std::size_t slot_count = render_formats.size();
+  const std::size_t task_count = period_count * slot_count;
+  std::vector<char> report_found(period_count, 0);
+  std::vector<char> standard_json_written(period_count, 0);
+  std::vector<char> format_written(task_count, 0);
+  std::vector<char> render_skipped(task_count, 0);
+  std::vector<std::vector<PendingManifestEntry>> manifest_updates(task_count);
+  {
+    ReportWriteQueue write_queue;
+    // 按窗口推进：先查询一个窗口的账期，再并行渲染，随后释放该窗口的报表，
+    // 内存中同时只保留 kPeriodWindowSize 份 StandardReport。
+    std::vector<std::optional<StandardReport>> reports;
+    for (std::size_t window_begin = 0U; window_begin < period_count;
+         window_begin += kPeriodWindowSize) {
+      const std::size_t window_size =
+          std::min(kPeriodWindowSize, period_count - window_begin);
+      // 查询共用同一个数据库连接，按账期串行执行；结果在渲染阶段只读共享。
+      reports.assign(window_size, std::nullopt);
+      for (std::size_t offset = 0U; offset < window_size; ++offset) {
+        const auto& period = plan.periods[window_begin + offset];
+        auto query_result =
+            period.kind == ReportExportPeriodKind::kYear
+                ? QueryService::QueryYear(*report_data_gateway_,
+                                          period.iso_period)
+                : QueryService::QueryMonth(*report_data_gateway_,
+                                           period.iso_period);
+        if (query_result.data_found) {
+          reports[offset] =
+              ReportRenderService::BuildStandardReport(std::move(query_result));
+          report_found[window_begin + offset] = 1;
+        }
+      }
+
+      bills::core::common::ParallelForEachIndex(
+          window_size * slot_count, jobs, [&](std::size_t window_task) {
+            const std::size_t offset = window_task / slot_count;
+            const std::size_t period_index = window_begin + offset;
+            const std::size_t slot = window_task % slot_count;
+            const std::size_t task_index = period_index * slot_count + slot;
+            if (!reports[offset].has_value() ||
+                render_destinations[slot].empty()) {
+              return;
+            }
+            const auto& period = plan.periods[period_index];
+            const auto& destinations = render_destinations[slot];
+            const std::string fingerprint = FingerprintStandardReport(
+                *reports[offset], render_formats[slot]);
+            std::vector<std::string> relative_paths;
+            relative_paths.reserve(destinations.size());
+            for (const auto& destination : destinations) {
+              relative_paths.push_back(
+                  (fs::path(destination.folder_name) / group_name_for(period) /
+                   (period.iso_period + destination.extension))
+                      .generic_string());
+            }
+            const auto written_flag =
+                [&](const ReportDestination& destination) {
+                  return destination.is_standard_json
+                             ? &standard_json_written[period_index]
+                             : &format_written[task_index];
+                };
+
+            if (incremental &&
+                std::ranges::all_of(relative_paths,
+                                    [&](const std::string& relative_path) {
+                                      return is_up_to_date(relative_path,
+                                                           fingerprint);
+                                    })) {
+              for (const auto& destination : destinations) {
+                *written_flag(destination) = 1;
+              }
+              render_skipped[task_index] = 1;
+              return;
+            }
+
+            auto rendered = std::make_shared<ChunkedReportContent>();
+            ReportRenderService::RenderTo(*reports[offset],
+                                          render_formats[slot], *rendered);
+            const std::shared_ptr<const ChunkedReportContent> content =
+                std::move(rendered);
+            for (std::size_t index = 0U; index < destinations.size(); ++index) {
+              char* written = written_flag(destinations[index]);
+              manifest_updates[task_index].push_back({
+                  .relative_path = relative_paths[index],
+                  .entry = {.fingerprint = fingerprint,
+                            .size = content->size()},
+                  .written = written,
+              });
+              write_queue.push({
+                  .output_path = export_base_dir / relative_paths[index],
+                  .content = content,
+                  .written = written,
+              });
+            }
+          });
+      reports.clear();
+    }
+    write_queue.close_and_wait();
   }
 
-  const auto standard_report = ReportRenderService::BuildStandardReport(query_result);
-  if (StandardReportRendererRegistry::IsFormatAvailable("json")) {
-    if (!write_standard_json("months/" + std::to_string(month.year),
-                             month.iso_month,
-                             ReportRenderService::Render(standard_report, "json"))) {
-      return {.ok = false};
+  bool manifest_changed = false;
+  for (auto& task_updates : manifest_updates) {
+    for (auto& update : task_updates) {
+      if (*update.written != 0) {
+        manifest.Set(update.relative_path, std::move(update.entry));
+      } else {
+        manifest.Erase(update.relative_path);
+      }
+      manifest_changed = true;
     }
   }
-  const std::string report = ReportRenderService::Render(standard_report, normalized_format);
-  if (!write_report(resolve_folder_name(format_folder_names_, normalized_format),
-                    "months/" + std::to_string(month.year), month.iso_month,
-                    extension_for_format(normalized_format), report)) {
-    return {.ok = false};
+  if (manifest_changed) {
+    // 清单写入失败只会让下次增量导出多渲染一次，不影响本次结果。
+    static_cast<void>(manifest.Save(export_base_dir));
   }
-  return {.ok = true, .exported_count = 1U};
+
+  for (std::size_t index = 0U; index < format_names.size(); ++index) {
+    if (!format_slots[index].has_value()) {
+      continue;
+    }
+    const std::size_t slot = *format_slots[index];
+    auto& result = results[index];
+    for (std::size_t period_index = 0U; period_index < period_count;
+         ++period_index) {
+      const bool exported =
+          report_found[period_index] != 0 &&
+          (!standard_json_enabled || standard_json_written[period_index] != 0) &&
+          format_written[period_index * slot_count + slot] != 0;
+      if (exported) {
+        ++result.exported_count;
+        if (render_skipped[period_index * slot_count + slot] != 0) {
+          ++result.unchanged_count;
+        }
+      } else {
+        result.ok = false;
+      }
+    }
+  }
+  return results;
+}
+
+auto ReportExportService::export_single_format(const ReportExportPlan& plan,
+                                               const std::string& format_name)
+    -> ReportExportRunResult {
+  return export_plan(plan, {format_name}).front();
+}
+
+auto ReportExportService::export_yearly_report(const ReportExportYear& year,
+                                               const std::string& format_name)
+    -> ReportExportRunResult {
+  return export_single_format(plan_yearly_report(year), format_name);
+}
+
+auto ReportExportService::export_monthly_report(const ReportExportMonth& month,
+                                                const std::string& format_name)
+    -> ReportExportRunResult {
+  return export_single_format(plan_monthly_report(month), format_name);
 }
 
 auto ReportExportService::export_monthly_range(const ReportExportRange& range,
                                                const std::string& format_name)
     -> ReportExportRunResult {
-  const auto normalized_months = list_normalized_available_months();
-  const int start_key = ReportExportMonthKey(range.start);
-  const int end_key = ReportExportMonthKey(range.end);
-  ReportExportRunResult result{.ok = true, .exported_count = 0U};
-  if (normalized_months.had_invalid_entries) {
-    result.ok = false;
-  }
-  for (const auto& month : normalized_months.months) {
-    const int current_key = ReportExportMonthKey(month);
-    if (current_key >= start_key && current_key <= end_key) {
-      const auto current_result = export_monthly_report(month, format_name);
-      result.ok = current_result.ok && result.ok;
-      result.exported_count += current_result.exported_count;
-    }
-  }
-  return result;
+  return export_single_format(plan_monthly_range(range), format_name);
 }
 
 auto ReportExportService::export_all_monthly_reports(const std::string& format_name)
     -> ReportExportRunResult {
-  const auto normalized_months = list_normalized_available_months();
-  ReportExportRunResult result{
-      .ok = !normalized_months.had_invalid_entries,
-      .exported_count = 0U,
-  };
-  for (const auto& month : normalized_months.months) {
-    const auto current_result = export_monthly_report(month, format_name);
-    result.ok = current_result.ok && result.ok;
-    result.exported_count += current_result.exported_count;
-  }
-  return result;
+  return export_single_format(plan_all_monthly_reports(), format_name);
 }
 
 auto ReportExportService::export_all_yearly_reports(const std::string& format_name)
     -> ReportExportRunResult {
-  std::set<int> years;
-  const auto normalized_months = list_normalized_available_months();
-  ReportExportRunResult result{
-      .ok = !normalized_months.had_invalid_entries,
-      .exported_count = 0U,
-  };
-  for (const auto& month : normalized_months.months) {
-    years.insert(month.year);
-  }
-  for (const auto& year : years) {
-    const auto current_result = export_yearly_report(
-        ReportExportYear{
-            .iso_year = std::to_string(year),
-            .year = year,
-        },
-        format_name);
-    result.ok = current_result.ok && result.ok;
-    result.exported_count += current_result.exported_count;
-  }
-  return result;
+  return export_single_format(plan_all_yearly_reports(), format_name);
 }
 
 auto ReportExportService::export_all_reports(const std::string& format_name)
     -> ReportExportRunResult {
-  const auto monthly_result = export_all_monthly_reports(format_name);
-  const auto yearly_result = export_all_yearly_reports(format_name);
-  return {
-      .ok = monthly_result.ok && yearly_result.ok,
-      .exported_count =
-          monthly_result.exported_count + yearly_result.exported_count,
-  };
+  return export_single_format(plan_all_reports(), format_name);
 }
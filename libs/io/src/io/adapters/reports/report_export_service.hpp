@@ -1,6 +1,7 @@
 #ifndef BILLS_IO_ADAPTERS_REPORTS_REPORT_EXPORT_SERVICE_HPP_
 #define BILLS_IO_ADAPTERS_REPORTS_REPORT_EXPORT_SERVICE_HPP_
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <optional>
@@ -28,7 +29,28 @@ struct ReportExportRange {
 
 struct ReportExportRunResult {
   bool ok = true;
+  // 包含增量导出中因内容未变而跳过的报表。
   std::size_t exported_count = 0U;
+  std::size_t unchanged_count = 0U;
+};
+
+enum class ReportExportPeriodKind {
+  kYear,
+  kMonth,
+};
+
+// 导出计划中的一个账期：对应一次查询和一份 StandardReport。
+struct ReportExportPeriod {
+  ReportExportPeriodKind kind = ReportExportPeriodKind::kMonth;
+  std::string iso_period;
+  int year = 0;
+};
+
+// 一次导出要覆盖的全部账期，与导出格式无关。
+struct ReportExportPlan {
+  std::vector<ReportExportPeriod> periods;
+  // 可用月份列表中存在无法解析的条目，所有格式都按失败处理。
+  bool had_invalid_entries = false;
 };
 
 [[nodiscard]] auto TryBuildReportExportYear(std::string_view raw)
@@ -69,6 +91,26 @@ class ReportExportService {
       -> ReportExportRunResult;
   [[nodiscard]] auto export_all_yearly_reports(const std::string& format_name)
       -> ReportExportRunResult;
+
+  [[nodiscard]] auto plan_yearly_report(const ReportExportYear& year) const
+      -> ReportExportPlan;
+  [[nodiscard]] auto plan_monthly_report(const ReportExportMonth& month) const
+      -> ReportExportPlan;
+  [[nodiscard]] auto plan_monthly_range(const ReportExportRange& range) const
+      -> ReportExportPlan;
+  [[nodiscard]] auto plan_all_reports() const -> ReportExportPlan;
+  [[nodiscard]] auto plan_all_monthly_reports() const -> ReportExportPlan;
+  [[nodiscard]] auto plan_all_yearly_reports() const -> ReportExportPlan;
+
+  // 按计划一次导出多种格式：每个账期只查询并组装一次 StandardReport，
+  // 账期 × 格式的渲染由 jobs 个线程并行执行（0 表示硬件并发数），
+  // 文件写入在单独的写线程上与渲染重叠。返回值与 format_names 一一对应。
+  // incremental 为 true 时，报表指纹与导出目录清单一致且文件仍在的账期
+  // 既不渲染也不改写，保持文件修改时间不变。
+  [[nodiscard]] auto export_plan(const ReportExportPlan& plan,
+                                 const std::vector<std::string>& format_names,
+                                 std::size_t jobs = 0U, bool incremental = false)
+      -> std::vector<ReportExportRunResult>;
   [[nodiscard]] static auto ListAvailableFormats() -> std::vector<std::string>;
 
  private:
@@ -79,11 +121,9 @@ class ReportExportService {
 
   [[nodiscard]] auto list_normalized_available_months() const
       -> NormalizedAvailableMonths;
-  bool write_report(const std::string& folder_name, const std::string& group_name,
-                    const std::string& stem, const std::string& extension,
-                    const std::string& content) const;
-  bool write_standard_json(const std::string& group_name, const std::string& stem,
-                           const std::string& content) const;
+  [[nodiscard]] auto export_single_format(const ReportExportPlan& plan,
+                                          const std::string& format_name)
+      -> ReportExportRunResult;
 
   std::unique_ptr<ReportDataGateway> report_data_gateway_;
   std::string export_base_dir_;
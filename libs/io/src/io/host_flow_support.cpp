@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <array>
+#include <charconv>
 #include <chrono>
 #include <cctype>
 #include <cstdint>
@@ -10,8 +11,11 @@
 #include <filesystem>
 #include <iomanip>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
+#include <span>
 #include <sstream>
 #include <stdexcept>
 #include <string_view>
@@ -20,6 +24,10 @@
 #include "io/adapters/reports/report_export_service.hpp"
 #include "common/iso_period.hpp"
 #include "io/adapters/config/config_document_parser.hpp"
+#include "io/adapters/db/bill_inserter.hpp"
+#include "io/adapters/db/ingest_manifest_store.hpp"
+#include "io/adapters/db/sqlite_performance_profile.hpp"
+#include "io/adapters/io/mapped_text_file.hpp"
 #include "io/adapters/io/source_document_io.hpp"
 #include "io/adapters/io/year_partition_output_path_builder.hpp"
 #include "io/adapters/io/zip_archive_io.hpp"
@@ -27,8 +35,11 @@
 #include "nlohmann/json.hpp"
 #include "query/query_service.hpp"
 #include "record_template/record_template_service.hpp"
+#include "reporting/renderers/report_json_writer.hpp"
+#include "reporting/renderers/report_output_sink.hpp"
 #include "reporting/renderers/standard_report_renderer_registry.hpp"
 #include "reporting/report_render_service.hpp"
+#include "reporting/standard_report/standard_report_json_serializer.hpp"
 
 namespace bills::io {
 namespace {
@@ -81,16 +92,11 @@ struct FileSnapshot {
   std::optional<std::string> previous_text;
 };
 
-struct SourceDocumentView {
-  std::string relative_path;
-  std::string text;
-};
-
+// 指向 ScannedSourceDocumentBatch 内的路径与正文，批次须在候选使用期间存活。
 struct RecordImportCandidate {
-  std::string absolute_path;
-  std::string relative_path;
+  std::string_view relative_path;
   std::string period;
-  std::string text;
+  std::string_view text;
 };
 
 auto MakeConfigValidationError(const ConfigBundleValidationReport& report) -> Error {
@@ -156,16 +162,129 @@ auto ParseAndValidateConfigTexts(
   };
 }
 
+auto Fnv1a64(std::string_view text) -> std::uint64_t {
+  constexpr std::uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+  constexpr std::uint64_t kFnvPrime = 1099511628211ULL;
+  std::uint64_t hash = kFnvOffsetBasis;
+  for (const unsigned char character : text) {
+    hash ^= character;
+    hash *= kFnvPrime;
+  }
+  return hash;
+}
+
+struct ConfigFileStamp {
+  std::uintmax_t size = 0U;
+  std::filesystem::file_time_type write_time{};
+
+  auto operator==(const ConfigFileStamp&) const -> bool = default;
+};
+
+using ConfigDirectoryStamp = std::array<ConfigFileStamp, kConfigFileNames.size()>;
+
+struct CachedConfigContext {
+  ConfigDirectoryStamp stamp{};
+  std::uint64_t content_hash = 0U;
+  std::filesystem::file_time_type verified_at{};
+  std::shared_ptr<const ValidatedConfigTextContext> context;
+};
+
+// 修改时间离上次确认不足该窗口时，相同的时间戳仍可能掩盖同一时间粒度内的
+// 又一次写入，此时要比较内容才能确认文件未变。配置缓存与入库清单共用。
+constexpr auto kRacyStampWindow = std::chrono::seconds(2);
+
+auto StampConfigDirectory(const std::filesystem::path& config_dir)
+    -> std::optional<ConfigDirectoryStamp> {
+  ConfigDirectoryStamp stamp{};
+  for (std::size_t index = 0; index < kConfigFileNames.size(); ++index) {
+    const std::filesystem::path file_path = config_dir / kConfigFileNames[index];
+    std::error_code size_error;
+    std::error_code time_error;
+    stamp[index].size = std::filesystem::file_size(file_path, size_error);
+    stamp[index].write_time =
+        std::filesystem::last_write_time(file_path, time_error);
+    if (size_error || time_error) {
+      return std::nullopt;
+    }
+  }
+  return stamp;
+}
+
+auto IsRacyConfigStamp(const ConfigDirectoryStamp& stamp,
+                       std::filesystem::file_time_type verified_at) -> bool {
+  return std::ranges::any_of(stamp, [verified_at](const ConfigFileStamp& file) {
+    return file.write_time + kRacyStampWindow >= verified_at;
+  });
+}
+
+auto HashConfigTexts(const ConfigTexts& texts) -> std::uint64_t {
+  std::string combined;
+  combined.reserve(texts.validator_text.size() + texts.modifier_text.size() +
+                   texts.export_formats_text.size() + 2U);
+  combined += texts.validator_text;
+  combined.push_back('\0');
+  combined += texts.modifier_text;
+  combined.push_back('\0');
+  combined += texts.export_formats_text;
+  return Fnv1a64(combined);
+}
+
+// 进程级缓存：以 config_dir 为键，三个配置文件的大小与修改时间都未变时直接
+// 复用已校验的配置，不再读取、解析与校验。时间戳变化时重新读取并比较内容哈希，
+// 内容相同只刷新时间戳，不同才重新解析。校验失败的结果不缓存。
+// 返回的上下文不可变，可在多次调用与多个线程之间共享。
 auto LoadValidatedConfigTextContext(const std::filesystem::path& config_dir)
-    -> Result<ValidatedConfigTextContext> {
+    -> Result<std::shared_ptr<const ValidatedConfigTextContext>> {
+  static std::mutex cache_mutex;
+  static std::map<std::string, CachedConfigContext> cache;
+
+  const std::string cache_key = config_dir.string();
+  const auto verified_at = std::filesystem::file_time_type::clock::now();
+  // 先取时间戳再读内容：读取期间发生的修改会让下次调用的时间戳不一致。
+  const auto stamp = StampConfigDirectory(config_dir);
+  if (stamp) {
+    const std::scoped_lock lock(cache_mutex);
+    const auto entry = cache.find(cache_key);
+    if (entry != cache.end() && entry->second.stamp == *stamp &&
+        !IsRacyConfigStamp(*stamp, entry->second.verified_at)) {
+      return entry->second.context;
+    }
+  }
+
   auto texts = ReadConfigTextsFromDirectory(config_dir);
   if (!texts) {
     return std::unexpected(texts.error());
   }
-  return ParseAndValidateConfigTexts(
-      *texts, (config_dir / kConfigFileNames[0]).string(),
+  const std::uint64_t content_hash = HashConfigTexts(*texts);
+  if (stamp) {
+    const std::scoped_lock lock(cache_mutex);
+    const auto entry = cache.find(cache_key);
+    if (entry != cache.end() && entry->second.content_hash == content_hash) {
+      entry->second.stamp = *stamp;
+      entry->second.verified_at = verified_at;
+      return entry->second.context;
+    }
+  }
+
+  auto validated = ParseAndValidateConfigTexts(
+      std::move(*texts), (config_dir / kConfigFileNames[0]).string(),
       (config_dir / kConfigFileNames[1]).string(),
       (config_dir / kConfigFileNames[2]).string());
+  if (!validated) {
+    return std::unexpected(validated.error());
+  }
+  auto context =
+      std::make_shared<const ValidatedConfigTextContext>(std::move(*validated));
+  if (stamp) {
+    const std::scoped_lock lock(cache_mutex);
+    cache.insert_or_assign(cache_key, CachedConfigContext{
+                                          .stamp = *stamp,
+                                          .content_hash = content_hash,
+                                          .verified_at = verified_at,
+                                          .context = context,
+                                      });
+  }
+  return context;
 }
 
 auto BuildValidationError(const BillWorkflowBatchResult& result,
@@ -767,13 +886,15 @@ auto MakeImportBackupBundleFailure(std::string phase, std::string message)
   return result;
 }
 
+// 返回的配置与缓存中的上下文共享所有权，不复制。
 auto LoadRuntimeConfig(const std::filesystem::path& config_dir)
-    -> Result<RuntimeConfigBundle> {
-  const auto validated_context = LoadValidatedConfigContext(config_dir);
-  if (!validated_context) {
-    return std::unexpected(validated_context.error());
+    -> Result<std::shared_ptr<const RuntimeConfigBundle>> {
+  const auto context = LoadValidatedConfigTextContext(config_dir);
+  if (!context) {
+    return std::unexpected(context.error());
   }
-  return validated_context->validated.runtime_config;
+  return std::shared_ptr<const RuntimeConfigBundle>(
+      *context, &(*context)->validated.runtime_config);
 }
 
 auto EnsureDbParentExists(const std::filesystem::path& db_path) -> Result<void> {
@@ -928,6 +1049,8 @@ auto ResetLegacyDatabaseIfNeeded(const std::filesystem::path& db_path) -> bool {
   }
 
   sqlite3_close(db_connection);
+  // 列结构兼容的旧库不在这里重建：DatabaseManager 打开时会按
+  // PRAGMA user_version 原地执行索引等 schema 迁移。
   if (should_reset) {
     RemoveDatabaseFamily(db_path);
   }
@@ -1027,7 +1150,7 @@ auto PreviewInlineRecordDocument(std::string_view expected_period,
       .text = std::string(raw_text),
   });
   const auto preview_result = RecordTemplateService::PreviewRecords(
-      documents, *runtime_config, *target_relative);
+      documents, **runtime_config, *target_relative);
   if (!preview_result) {
     return std::unexpected(
         MakeError(FormatRecordTemplateError(preview_result.error()), kContext));
@@ -1117,43 +1240,82 @@ auto CommitValidatedRecordTextToWorkspaceAndDatabase(
   };
 }
 
-auto LoadSourceDocumentViews(const std::filesystem::path& input_path)
-    -> Result<std::map<std::string, SourceDocumentView>> {
-  const auto absolute_documents = LoadSourceDocuments(input_path, ".txt");
-  if (!absolute_documents) {
-    return std::unexpected(absolute_documents.error());
-  }
-  const auto relative_documents =
-      SourceDocumentIo::LoadByExtensionRelative(input_path, ".txt");
-  if (!relative_documents) {
-    return std::unexpected(relative_documents.error());
+auto PreviewLoadedRecordDocuments(const SourceDocumentBatch& documents,
+                                  const RuntimeConfigBundle& runtime_config,
+                                  const std::filesystem::path& input_path)
+    -> Result<RecordPreviewResult> {
+  auto result = RecordTemplateService::PreviewRecords(documents, runtime_config,
+                                                      input_path.string());
+  if (!result) {
+    return std::unexpected(
+        MakeError(FormatRecordTemplateError(result.error()), kContext));
   }
-  if (absolute_documents->size() != relative_documents->size()) {
-    return std::unexpected(MakeError(
-        "Absolute and relative TXT document views are inconsistent.", kContext));
+  return std::move(*result);
+}
+
+// 按路径把预览结果对应回扫描批次；未通过校验的文件计入 result 的失败统计。
+auto CollectRecordImportCandidates(const ScannedSourceDocumentBatch& scanned,
+                                   const RecordPreviewResult& preview_result,
+                                   HostRecordDirectoryImportResult& result)
+    -> std::vector<RecordImportCandidate> {
+  std::map<std::string_view, const RecordPreviewFile*> preview_by_path;
+  for (const auto& file : preview_result.files) {
+    preview_by_path.emplace(file.path, &file);
   }
 
-  std::map<std::string, SourceDocumentView> views;
-  for (std::size_t index = 0; index < absolute_documents->size(); ++index) {
-    views.emplace((*absolute_documents)[index].display_path,
-                  SourceDocumentView{
-                      .relative_path = (*relative_documents)[index].display_path,
-                      .text = (*absolute_documents)[index].text,
-                  });
+  std::vector<RecordImportCandidate> candidates;
+  candidates.reserve(scanned.documents.size());
+  for (std::size_t index = 0; index < scanned.documents.size(); ++index) {
+    const auto& document = scanned.documents[index];
+    const std::string& relative_path = scanned.relative_paths[index];
+    const auto preview_it = preview_by_path.find(document.display_path);
+    if (preview_it == preview_by_path.end()) {
+      ++result.failure;
+      if (result.first_failure_message.empty()) {
+        result.first_failure_message =
+            "No validation result was returned for " + relative_path + ".";
+      }
+      continue;
+    }
+
+    const auto& preview_file = *preview_it->second;
+    if (!preview_file.ok || preview_file.period.empty()) {
+      ++result.failure;
+      ++result.invalid;
+      if (result.first_failure_message.empty()) {
+        result.first_failure_message =
+            !preview_file.error.empty()
+                ? preview_file.error
+                : "TXT validation failed for " + relative_path + ".";
+      }
+      continue;
+    }
+
+    candidates.push_back(RecordImportCandidate{
+        .relative_path = relative_path,
+        .period = preview_file.period,
+        .text = document.text,
+    });
   }
-  return views;
+  return candidates;
 }
 
 auto CountMatchingYearBills(sqlite3* db_connection, std::string_view iso_year)
     -> int {
-  const char* sql = "SELECT COUNT(*) FROM bills WHERE substr(bill_date, 1, 4) = ?;";
+  int year = 0;
+  const auto [end, error] =
+      std::from_chars(iso_year.data(), iso_year.data() + iso_year.size(), year);
+  if (error != std::errc{} || end != iso_year.data() + iso_year.size()) {
+    return 0;
+  }
+
+  const char* sql = "SELECT COUNT(*) FROM bills WHERE year = ?;";
   sqlite3_stmt* statement = nullptr;
   if (sqlite3_prepare_v2(db_connection, sql, -1, &statement, nullptr) != SQLITE_OK) {
     throw std::runtime_error("Failed to prepare year bill count query.");
   }
 
-  sqlite3_bind_text(statement, 1, iso_year.data(),
-                    static_cast<int>(iso_year.size()), SQLITE_TRANSIENT);
+  sqlite3_bind_int(statement, 1, year);
 
   int result = 0;
   if (sqlite3_step(statement) == SQLITE_ROW) {
@@ -1192,22 +1354,8 @@ auto CountTransactions(const MonthlyReportData& report) -> std::size_t {
   return count;
 }
 
-auto BuildEmptyChartData() -> nlohmann::json {
-  return {
-      {"schema_version", "1.0.0"},
-      {"views", nlohmann::json::array()},
-  };
-}
-
 auto StableColorIndex(std::string_view key, std::size_t palette_size) -> std::size_t {
-  constexpr std::uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
-  constexpr std::uint64_t kFnvPrime = 1099511628211ULL;
-  std::uint64_t hash = kFnvOffsetBasis;
-  for (const unsigned char character : key) {
-    hash ^= character;
-    hash *= kFnvPrime;
-  }
-  return static_cast<std::size_t>(hash % palette_size);
+  return static_cast<std::size_t>(Fnv1a64(key) % palette_size);
 }
 
 auto FixedPieChartPalette() -> const std::array<std::string_view, 8U>& {
@@ -1218,13 +1366,13 @@ auto FixedPieChartPalette() -> const std::array<std::string_view, 8U>& {
   return palette;
 }
 
-auto ResolvePieChartColorHex(std::string_view category_key) -> std::string {
+auto ResolvePieChartColorHex(std::string_view category_key) -> std::string_view {
   const auto& palette = FixedPieChartPalette();
-  return std::string(
-      palette[StableColorIndex(category_key, palette.size())]);
+  return palette[StableColorIndex(category_key, palette.size())];
 }
 
-auto ResolveGroupedBarSeriesColorHex(std::string_view series_id) -> std::string {
+auto ResolveGroupedBarSeriesColorHex(std::string_view series_id)
+    -> std::string_view {
   if (series_id == "income") {
     return "#2563EB";
   }
@@ -1237,12 +1385,58 @@ auto ResolveGroupedBarSeriesColorHex(std::string_view series_id) -> std::string
   return "#7C3AED";
 }
 
-auto BuildYearlyMonthlyOverviewChart(const YearlyReportData& report)
-    -> std::optional<nlohmann::json> {
+void WriteGroupedBarSeries(ReportJsonWriter& writer, std::string_view series_id,
+                           std::string_view label,
+                           std::span<const double> values) {
+  writer.BeginObject();
+  writer.StringField("id", series_id);
+  writer.StringField("label", label);
+  writer.StringField("unit", "CNY");
+  writer.StringField("color", ResolveGroupedBarSeriesColorHex(series_id));
+  writer.Key("values");
+  writer.BeginArray();
+  for (const double value : values) {
+    writer.Number(value);
+  }
+  writer.EndArray();
+  writer.EndObject();
+}
+
+// 收入/支出/结余三组柱状图；x_labels 与三组取值按下标一一对应。
+void WriteGroupedBarChart(ReportJsonWriter& writer, std::string_view chart_id,
+                          std::span<const std::string_view> x_labels,
+                          std::span<const double> income_values,
+                          std::span<const double> expense_values,
+                          std::span<const double> balance_values) {
+  writer.BeginObject();
+  writer.StringField("id", chart_id);
+  writer.StringField("title", "Monthly Income, Expense, and Balance");
+  writer.StringField("chart_type", "grouped_bar");
+  writer.Key("x_labels");
+  writer.BeginArray();
+  for (const std::string_view label : x_labels) {
+    writer.String(label);
+  }
+  writer.EndArray();
+  writer.Key("series");
+  writer.BeginArray();
+  WriteGroupedBarSeries(writer, "income", "Income", income_values);
+  WriteGroupedBarSeries(writer, "expense", "Expense", expense_values);
+  WriteGroupedBarSeries(writer, "balance", "Balance", balance_values);
+  writer.EndArray();
+  writer.EndObject();
+}
+
+void WriteYearlyMonthlyOverviewChart(ReportJsonWriter& writer,
+                                     const YearlyReportData& report) {
   if (!report.data_found || report.monthly_summary.empty()) {
-    return std::nullopt;
+    return;
   }
 
+  static constexpr std::array<std::string_view, 12U> kMonthLabels = {
+      "01", "02", "03", "04", "05", "06",
+      "07", "08", "09", "10", "11", "12",
+  };
   std::array<double, 12U> income_values{};
   std::array<double, 12U> expense_values{};
   std::array<double, 12U> balance_values{};
@@ -1251,84 +1445,65 @@ auto BuildYearlyMonthlyOverviewChart(const YearlyReportData& report)
       continue;
     }
     const std::size_t index = static_cast<std::size_t>(month - 1);
-    income_values[index] = summary.income;
-    expense_values[index] = std::abs(summary.expense);
-    balance_values[index] = summary.income + summary.expense;
+    income_values[index] = summary.income.ToDouble();
+    expense_values[index] = std::abs(summary.expense.ToDouble());
+    balance_values[index] = (summary.income + summary.expense).ToDouble();
   }
 
-  nlohmann::json x_labels = nlohmann::json::array();
-  for (int month = 1; month <= 12; ++month) {
-    std::ostringstream stream;
-    stream << std::setw(2) << std::setfill('0') << month;
-    x_labels.push_back(stream.str());
+  WriteGroupedBarChart(writer, "yearly_monthly_overview", kMonthLabels,
+                       income_values, expense_values, balance_values);
+}
+
+void WriteRangeMonthlyOverviewChart(ReportJsonWriter& writer,
+                                    const RangeReportData& report) {
+  if (!report.data_found || report.monthly_summary.empty()) {
+    return;
   }
 
-  const auto to_json_array = [](const auto& values) -> nlohmann::json {
-    nlohmann::json result = nlohmann::json::array();
-    for (const double value : values) {
-      result.push_back(value);
-    }
-    return result;
-  };
+  std::vector<std::string_view> x_labels;
+  std::vector<double> income_values;
+  std::vector<double> expense_values;
+  std::vector<double> balance_values;
+  x_labels.reserve(report.monthly_summary.size());
+  income_values.reserve(report.monthly_summary.size());
+  expense_values.reserve(report.monthly_summary.size());
+  balance_values.reserve(report.monthly_summary.size());
+  for (const auto& [iso_month, summary] : report.monthly_summary) {
+    x_labels.push_back(iso_month);
+    income_values.push_back(summary.income.ToDouble());
+    expense_values.push_back(std::abs(summary.expense.ToDouble()));
+    balance_values.push_back((summary.income + summary.expense).ToDouble());
+  }
 
-  return nlohmann::json{
-      {"id", "yearly_monthly_overview"},
-      {"title", "Monthly Income, Expense, and Balance"},
-      {"chart_type", "grouped_bar"},
-      {"x_labels", std::move(x_labels)},
-      {"series",
-       nlohmann::json::array(
-           {nlohmann::json{{"id", "income"},
-                           {"label", "Income"},
-                           {"unit", "CNY"},
-                           {"color", ResolveGroupedBarSeriesColorHex("income")},
-                           {"values", to_json_array(income_values)}},
-            nlohmann::json{{"id", "expense"},
-                           {"label", "Expense"},
-                           {"unit", "CNY"},
-                           {"color", ResolveGroupedBarSeriesColorHex("expense")},
-                           {"values", to_json_array(expense_values)}},
-            nlohmann::json{{"id", "balance"},
-                           {"label", "Balance"},
-                           {"unit", "CNY"},
-                           {"color", ResolveGroupedBarSeriesColorHex("balance")},
-                           {"values", to_json_array(balance_values)}}})},
-  };
+  WriteGroupedBarChart(writer, "range_monthly_overview", x_labels,
+                       income_values, expense_values, balance_values);
 }
 
-auto BuildMonthlyExpenseByCategoryChart(const MonthlyReportData& report)
-    -> std::optional<nlohmann::json> {
-  if (!report.data_found) {
-    return std::nullopt;
-  }
-
+void WriteExpenseByCategoryChart(
+    ReportJsonWriter& writer,
+    const std::map<std::string, ParentCategoryData>& aggregated_data,
+    std::string_view chart_id) {
   struct Segment {
-    std::string id;
-    std::string label;
+    std::string_view label;
     double value = 0.0;
   };
 
   std::vector<Segment> segments;
-  segments.reserve(report.aggregated_data.size());
-  for (const auto& [category_name, category] : report.aggregated_data) {
-    if (category.parent_total >= 0.0) {
-      continue;
-    }
-    const double absolute_value = std::abs(category.parent_total);
-    if (absolute_value <= 0.0) {
+  segments.reserve(aggregated_data.size());
+  for (const auto& [category_name, category] : aggregated_data) {
+    if (category.parent_total >= Money{}) {
       continue;
     }
-    const std::string normalized_name =
-        category_name.empty() ? "uncategorized" : category_name;
+    const double absolute_value = (-category.parent_total).ToDouble();
     segments.push_back(Segment{
-        .id = normalized_name,
-        .label = normalized_name,
+        .label = category_name.empty() ? std::string_view("uncategorized")
+                                       : std::string_view(category_name),
         .value = absolute_value,
     });
   }
 
   if (segments.empty()) {
-    return std::nullopt;
+    return;
   }
 
   std::sort(segments.begin(), segments.end(),
@@ -1339,68 +1514,50 @@ auto BuildMonthlyExpenseByCategoryChart(const MonthlyReportData& report)
               return left.value > right.value;
             });
 
-  nlohmann::json json_segments = nlohmann::json::array();
+  writer.BeginObject();
+  writer.StringField("id", chart_id);
+  writer.StringField("title", "Expense by Category");
+  writer.StringField("chart_type", "pie");
+  writer.StringField("unit", "CNY");
+  writer.Key("segments");
+  writer.BeginArray();
   for (const auto& segment : segments) {
-    json_segments.push_back(nlohmann::json{
-        {"id", segment.id},
-        {"label", segment.label},
-        {"value", segment.value},
-        {"color", ResolvePieChartColorHex(segment.id)},
-    });
-  }
-
-  return nlohmann::json{
-      {"id", "monthly_expense_by_category"},
-      {"title", "Expense by Category"},
-      {"chart_type", "pie"},
-      {"unit", "CNY"},
-      {"segments", std::move(json_segments)},
-  };
-}
-
-auto BuildChartData(const QueryExecutionResult& query_result) -> nlohmann::json {
-  nlohmann::json chart_data = BuildEmptyChartData();
-  auto& views = chart_data["views"];
+    writer.BeginObject();
+    writer.StringField("id", segment.label);
+    writer.StringField("label", segment.label);
+    writer.NumberField("value", segment.value);
+    writer.StringField("color", ResolvePieChartColorHex(segment.label));
+    writer.EndObject();
+  }
+  writer.EndArray();
+  writer.EndObject();
+}
+
+// 写出 extensions.chart_data 的值；没有数据的图表不进入 views。
+void WriteChartData(ReportJsonWriter& writer,
+                    const QueryExecutionResult& query_result) {
+  writer.BeginObject();
+  writer.StringField("schema_version", "1.0.0");
+  writer.Key("views");
+  writer.BeginArray();
   if (query_result.query_type == "year") {
-    const auto yearly_chart =
-        BuildYearlyMonthlyOverviewChart(query_result.yearly_data);
-    if (yearly_chart.has_value()) {
-      views.push_back(*yearly_chart);
+    WriteYearlyMonthlyOverviewChart(writer, query_result.yearly_data);
+  } else if (query_result.query_type == "month") {
+    if (query_result.monthly_data.data_found) {
+      WriteExpenseByCategoryChart(writer,
+                                  query_result.monthly_data.aggregated_data,
+                                  "monthly_expense_by_category");
     }
-    return chart_data;
-  }
-
-  if (query_result.query_type == "month") {
-    const auto monthly_chart =
-        BuildMonthlyExpenseByCategoryChart(query_result.monthly_data);
-    if (monthly_chart.has_value()) {
-      views.push_back(*monthly_chart);
+  } else if (query_result.query_type == "range") {
+    const auto& range_data = query_result.range_data;
+    WriteRangeMonthlyOverviewChart(writer, range_data);
+    if (range_data.data_found) {
+      WriteExpenseByCategoryChart(writer, range_data.aggregated_data,
+                                  "range_expense_by_category");
     }
   }
-  return chart_data;
-}
-
-auto InjectChartDataIntoStandardReportJson(
-    std::string_view standard_report_json,
-    const QueryExecutionResult& query_result) -> std::string {
-  if (standard_report_json.empty()) {
-    return std::string(standard_report_json);
-  }
-
-  try {
-    nlohmann::json root = nlohmann::json::parse(standard_report_json);
-    if (!root.is_object()) {
-      return std::string(standard_report_json);
-    }
-    auto& extensions = root["extensions"];
-    if (!extensions.is_object()) {
-      extensions = nlohmann::json::object();
-    }
-    extensions["chart_data"] = BuildChartData(query_result);
-    return root.dump(2) + "\n";
-  } catch (const nlohmann::json::exception&) {
-    return std::string(standard_report_json);
-  }
+  writer.EndArray();
+  writer.EndObject();
 }
 
 auto BuildHostQueryResult(const QueryExecutionResult& query_result,
@@ -1410,10 +1567,15 @@ auto BuildHostQueryResult(const QueryExecutionResult& query_result,
   result.execution = query_result;
   result.standard_report = ReportRenderService::BuildStandardReport(query_result);
   if (StandardReportRendererRegistry::IsFormatAvailable("json")) {
-    result.standard_report_json =
-        ReportRenderService::Render(result.standard_report, "json");
-    result.standard_report_json = InjectChartDataIntoStandardReportJson(
-        result.standard_report_json, query_result);
+    // 图表数据在同一次流式输出中写入 extensions.chart_data，无需再解析一遍。
+    StringReportOutputSink sink(result.standard_report_json);
+    StandardReportJsonSerializer::WriteTo(
+        result.standard_report, sink,
+        [&query_result](ReportJsonWriter& writer) {
+          writer.Key("chart_data");
+          WriteChartData(writer, query_result);
+        });
+    result.standard_report_json.push_back('\n');
   }
   if (StandardReportRendererRegistry::IsFormatAvailable("md")) {
     result.report_markdown =
@@ -1422,6 +1584,9 @@ auto BuildHostQueryResult(const QueryExecutionResult& query_result,
   if (query_result.query_type == "year") {
     result.matched_bills =
         static_cast<std::size_t>(CountMatchingYearBills(db_connection, query_value));
+  } else if (query_result.query_type == "range") {
+    // bill_date 唯一，区间内每个月恰好对应一张账单，无需再查一次。
+    result.matched_bills = query_result.range_data.monthly_summary.size();
   } else {
     result.matched_bills =
         static_cast<std::size_t>(CountMatchingMonthBills(db_connection, query_value));
@@ -1430,6 +1595,190 @@ auto BuildHostQueryResult(const QueryExecutionResult& query_result,
   return result;
 }
 
+// 清单中的源文件键：绝对、规范化的通用路径，与调用方传入的相对路径写法无关。
+auto ManifestSourcePath(const std::filesystem::path& file_path) -> std::string {
+  std::error_code absolute_error;
+  const std::filesystem::path absolute_path =
+      std::filesystem::absolute(file_path, absolute_error);
+  if (absolute_error) {
+    return file_path.lexically_normal().generic_string();
+  }
+  return absolute_path.lexically_normal().generic_string();
+}
+
+auto FingerprintText(std::string_view text) -> std::string {
+  constexpr std::size_t kHexDigits = 16U;
+  std::array<char, kHexDigits> buffer{};
+  const auto hash = Fnv1a64(text);
+  char* end =
+      std::to_chars(buffer.data(), buffer.data() + buffer.size(), hash, 16).ptr;
+  std::string digest(kHexDigits - static_cast<std::size_t>(end - buffer.data()),
+                     '0');
+  digest.append(buffer.data(), end);
+  return digest;
+}
+
+// 只有校验与修正配置影响入库结果；导出格式的变化不需要重新入库。
+auto IngestConfigFingerprint(const ConfigTexts& texts) -> std::string {
+  std::string combined = texts.validator_text;
+  combined.push_back('\0');
+  combined += texts.modifier_text;
+  return FingerprintText(combined);
+}
+
+struct IngestSourceStat {
+  std::int64_t size = 0;
+  std::int64_t mtime_ns = 0;
+};
+
+// 与 IngestSourceStat::mtime_ns 同一时钟的当前时间，记为指纹的确认时间。
+auto IngestVerificationTimeNs() -> std::int64_t {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::filesystem::file_time_type::clock::now().time_since_epoch())
+      .count();
+}
+
+// 指纹记录时文件刚被修改过：之后同一时间粒度内的写入不会改变 size/mtime，
+// 只能靠内容哈希确认未变。确认时间未知（迁移前的记录为 0）同样视为竞态。
+auto IsRacyManifestEntry(const IngestManifestEntry& entry) -> bool {
+  const std::int64_t window_ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(kRacyStampWindow)
+          .count();
+  return entry.verified_ns == 0 ||
+         entry.mtime_ns + window_ns >= entry.verified_ns;
+}
+
+auto StatIngestSource(const std::filesystem::path& file_path)
+    -> Result<IngestSourceStat> {
+  std::error_code size_error;
+  const auto size = std::filesystem::file_size(file_path, size_error);
+  std::error_code time_error;
+  const auto write_time = std::filesystem::last_write_time(file_path, time_error);
+  if (size_error || time_error) {
+    return std::unexpected(
+        MakeError("Failed to stat file: " + file_path.string(), kContext));
+  }
+  return IngestSourceStat{
+      .size = static_cast<std::int64_t>(size),
+      .mtime_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      write_time.time_since_epoch())
+                      .count(),
+  };
+}
+
+// 只收集解析出的账单而不写库，由调用方在一个事务中统一提交。
+class StagedBillRepository final : public BillRepository {
+ public:
+  void InsertBill(const ParsedBill& bill_data) override {
+    bills_.push_back(bill_data);
+  }
+
+  auto InsertBills(std::span<const ParsedBill> bills)
+      -> std::vector<BillInsertFailure> override {
+    bills_.insert(bills_.end(), bills.begin(), bills.end());
+    return {};
+  }
+
+  [[nodiscard]] auto bills() const -> std::span<const ParsedBill> {
+    return bills_;
+  }
+
+ private:
+  std::vector<ParsedBill> bills_;
+};
+
+// 批量提交已校验的记录：一次快照并写入全部工作区文件，再在一个 SQLite 事务中
+// 写入全部账单及其入库清单。任一步失败都会恢复全部快照，数据库事务整体回滚，
+// 因此工作区与数据库要么同时更新，要么都保持原状。返回被覆盖的已有文件数。
+auto CommitRecordBatchToWorkspaceAndDatabase(
+    std::span<const RecordImportCandidate> candidates,
+    const SourceDocumentBatch& targets,
+    const ValidatedConfigTextContext& config_context,
+    const std::filesystem::path& records_root,
+    const std::filesystem::path& db_path) -> Result<std::size_t> {
+  const auto ensure_db = EnsureDbParentExists(db_path);
+  if (!ensure_db) {
+    return std::unexpected(ensure_db.error());
+  }
+  // 快照只依赖 display_path，targets 不需要携带正文。
+  const auto snapshots = CaptureSnapshots(records_root, targets);
+  if (!snapshots) {
+    return std::unexpected(MakeError("Failed to prepare records for save: " +
+                                     FormatError(snapshots.error())));
+  }
+  const auto fail_with_rollback = [&](std::string message) {
+    return std::unexpected(MakeError(AppendRollbackFailure(
+        std::move(message), RestoreSnapshots(records_root, *snapshots))));
+  };
+
+  std::vector<std::filesystem::path> target_paths;
+  target_paths.reserve(targets.size());
+  for (std::size_t index = 0; index < targets.size(); ++index) {
+    const auto& target_path = target_paths.emplace_back(
+        records_root / std::filesystem::path(targets[index].display_path));
+    const auto write_result =
+        SourceDocumentIo::WriteText(target_path, candidates[index].text);
+    if (!write_result) {
+      return fail_with_rollback("Failed to write " +
+                                std::string(candidates[index].relative_path) +
+                                " to " + targets[index].display_path + ": " +
+                                FormatError(write_result.error()));
+    }
+  }
+
+  // 解析使用刚写入的同一份正文，无需重新读取文件或加载配置。
+  SourceDocumentRefBatch documents;
+  documents.reserve(candidates.size());
+  for (std::size_t index = 0; index < candidates.size(); ++index) {
+    documents.push_back(SourceDocumentRef{
+        .display_path = target_paths[index].string(),
+        .text = candidates[index].text,
+    });
+  }
+  StagedBillRepository staged_bills;
+  const BillWorkflowBatchResult parsed = BillWorkflowService::Ingest(
+      documents, config_context.validated.runtime_config, staged_bills, false);
+  if (parsed.failure > 0U) {
+    return fail_with_rollback(BuildBatchFailureMessage(
+        parsed, "Failed to parse imported records for SQLite sync."));
+  }
+
+  const std::string config_hash = IngestConfigFingerprint(config_context.texts);
+  const std::int64_t verified_ns = IngestVerificationTimeNs();
+  IngestManifestUpdate manifest_update;
+  manifest_update.upserts.reserve(candidates.size());
+  for (std::size_t index = 0; index < candidates.size(); ++index) {
+    const auto file_stat = StatIngestSource(target_paths[index]);
+    if (!file_stat) {
+      return fail_with_rollback(FormatError(file_stat.error()));
+    }
+    IngestManifestEntry entry;
+    entry.source_path = ManifestSourcePath(target_paths[index]);
+    entry.bill_date = bills::core::common::iso_period::format_year_month(
+        parsed.files[index].year, parsed.files[index].month);
+    entry.size = file_stat->size;
+    entry.mtime_ns = file_stat->mtime_ns;
+    entry.content_hash = FingerprintText(candidates[index].text);
+    entry.config_hash = config_hash;
+    entry.verified_ns = verified_ns;
+    manifest_update.upserts.push_back(std::move(entry));
+  }
+
+  try {
+    BillInserter(db_path.string())
+        .insert_bills_atomically(staged_bills.bills(), manifest_update);
+  } catch (const std::exception& error) {
+    return fail_with_rollback("Failed to sync " +
+                              std::to_string(candidates.size()) +
+                              " records into SQLite: " + error.what());
+  }
+
+  return static_cast<std::size_t>(std::ranges::count_if(
+      *snapshots, [](const FileSnapshot& snapshot) {
+        return snapshot.previous_text.has_value();
+      }));
+}
+
 template <typename Callback>
 auto RunTextWorkflow(const std::filesystem::path& input_path,
                      const std::filesystem::path& config_dir, Callback&& callback)
@@ -1438,15 +1787,30 @@ auto RunTextWorkflow(const std::filesystem::path& input_path,
   if (!runtime_config) {
     return std::unexpected(runtime_config.error());
   }
-  const auto documents = LoadSourceDocuments(input_path, ".txt");
+  // 文档只在回调期间使用，直接解析映射的文件字节，不复制内容。
+  const auto documents = SourceDocumentIo::MapByExtension(input_path, ".txt");
   if (!documents) {
     return std::unexpected(documents.error());
   }
-  return callback(*documents, *runtime_config);
+  return callback(std::span<const SourceDocumentRef>(documents->documents),
+                  **runtime_config);
 }
 
 }  // namespace
 
+auto SelectDatabaseProfile(std::string_view profile_name) -> Result<void> {
+  const auto profile = ParseSqlitePerformanceProfile(profile_name);
+  if (!profile.has_value()) {
+    return std::unexpected(MakeError(
+        "Unknown database profile '" + std::string(profile_name) +
+            "'. Expected one of: " +
+            std::string(kSqlitePerformanceProfileNames) + ".",
+        kContext));
+  }
+  SetSqlitePerformanceProfile(*profile);
+  return {};
+}
+
 auto LoadValidatedConfigContext(const std::filesystem::path& config_dir)
     -> Result<HostConfigContext> {
   const auto context = LoadValidatedConfigTextContext(config_dir);
@@ -1455,8 +1819,8 @@ auto LoadValidatedConfigContext(const std::filesystem::path& config_dir)
   }
 
   return HostConfigContext{
-      .documents = context->documents,
-      .validated = context->validated,
+      .documents = (*context)->documents,
+      .validated = (*context)->validated,
   };
 }
 
@@ -1467,28 +1831,29 @@ auto LoadSourceDocuments(const std::filesystem::path& root_path,
 
 auto ListEnabledExportFormats(const std::filesystem::path& config_dir)
     -> Result<std::vector<std::string>> {
-  const auto validated_context = LoadValidatedConfigContext(config_dir);
+  const auto validated_context = LoadValidatedConfigTextContext(config_dir);
   if (!validated_context) {
     return std::unexpected(validated_context.error());
   }
-  return validated_context->validated.report.enabled_export_formats;
+  return (*validated_context)->validated.report.enabled_export_formats;
 }
 
 auto InspectConfig(const std::filesystem::path& config_dir)
     -> Result<HostConfigInspectionResult> {
-  const auto validated_context = LoadValidatedConfigContext(config_dir);
+  const auto validated_context = LoadValidatedConfigTextContext(config_dir);
   if (!validated_context) {
     return std::unexpected(validated_context.error());
   }
-  const auto inspect_result =
-      RecordTemplateService::InspectConfig(validated_context->documents.validator);
+  const auto inspect_result = RecordTemplateService::InspectConfig(
+      (*validated_context)->documents.validator);
   if (!inspect_result) {
     return std::unexpected(MakeError(FormatRecordTemplateError(inspect_result.error()),
                                      kContext));
   }
   return HostConfigInspectionResult{
       .inspect = *inspect_result,
-      .enabled_export_formats = validated_context->validated.report.enabled_export_formats,
+      .enabled_export_formats =
+          (*validated_context)->validated.report.enabled_export_formats,
       .available_export_formats = ReportExportService::ListAvailableFormats(),
   };
 }
@@ -1528,12 +1893,12 @@ auto GenerateTemplatesFromConfig(
     const std::filesystem::path& config_dir,
     const HostTemplateGenerationRequest& request)
     -> Result<TemplateGenerationResult> {
-  const auto validated_context = LoadValidatedConfigContext(config_dir);
+  const auto validated_context = LoadValidatedConfigTextContext(config_dir);
   if (!validated_context) {
     return std::unexpected(validated_context.error());
   }
   const auto layout = RecordTemplateService::BuildOrderedTemplateLayout(
-      validated_context->documents.validator);
+      (*validated_context)->documents.validator);
   if (!layout) {
     return std::unexpected(
         MakeError(FormatRecordTemplateError(layout.error()), kContext));
@@ -1566,13 +1931,7 @@ auto PreviewRecordDocuments(const std::filesystem::path& input_path,
   if (!documents) {
     return std::unexpected(documents.error());
   }
-  const auto result = RecordTemplateService::PreviewRecords(
-      *documents, *runtime_config, input_path.string());
-  if (!result) {
-    return std::unexpected(
-        MakeError(FormatRecordTemplateError(result.error()), kContext));
-  }
-  return *result;
+  return PreviewLoadedRecordDocuments(*documents, **runtime_config, input_path);
 }
 
 auto ListRecordPeriods(const std::filesystem::path& input_path)
@@ -1591,49 +1950,183 @@ auto ListRecordPeriods(const std::filesystem::path& input_path)
 }
 
 auto ValidateDocuments(const std::filesystem::path& input_path,
-                       const std::filesystem::path& config_dir)
+                       const std::filesystem::path& config_dir, std::size_t jobs)
     -> Result<BillWorkflowBatchResult> {
   return RunTextWorkflow(
       input_path, config_dir,
-      [](const SourceDocumentBatch& documents,
-         const RuntimeConfigBundle& runtime_config) {
+      [jobs](std::span<const SourceDocumentRef> documents,
+             const RuntimeConfigBundle& runtime_config) {
         return Result<BillWorkflowBatchResult>(
-            BillWorkflowService::Validate(documents, runtime_config));
+            BillWorkflowService::Validate(documents, runtime_config, jobs));
       });
 }
 
 auto ConvertDocuments(const std::filesystem::path& input_path,
                       const std::filesystem::path& config_dir,
-                      bool include_serialized_json)
+                      bool include_serialized_json, std::size_t jobs)
     -> Result<BillWorkflowBatchResult> {
   return RunTextWorkflow(
       input_path, config_dir,
-      [include_serialized_json](const SourceDocumentBatch& documents,
-                                const RuntimeConfigBundle& runtime_config) {
+      [include_serialized_json, jobs](std::span<const SourceDocumentRef> documents,
+                                      const RuntimeConfigBundle& runtime_config) {
         return Result<BillWorkflowBatchResult>(
             BillWorkflowService::Convert(documents, runtime_config,
-                                         include_serialized_json));
+                                         include_serialized_json, jobs));
       });
 }
 
 auto IngestDocuments(const std::filesystem::path& input_path,
                      const std::filesystem::path& config_dir,
                      const std::filesystem::path& db_path,
-                     bool include_serialized_json)
-    -> Result<BillWorkflowBatchResult> {
+                     bool include_serialized_json, std::size_t jobs,
+                     bool incremental) -> Result<BillWorkflowBatchResult> {
   const auto ensure_db = EnsureDbParentExists(db_path);
   if (!ensure_db) {
     return std::unexpected(ensure_db.error());
   }
-  return RunTextWorkflow(
-      input_path, config_dir,
-      [&db_path, include_serialized_json](
-          const SourceDocumentBatch& documents,
-          const RuntimeConfigBundle& runtime_config) -> Result<BillWorkflowBatchResult> {
-        auto repository = bills::io::CreateBillRepository(db_path.string());
-        return BillWorkflowBatchResult(BillWorkflowService::Ingest(
-            documents, runtime_config, *repository, include_serialized_json));
-      });
+  const auto config_context = LoadValidatedConfigTextContext(config_dir);
+  if (!config_context) {
+    return std::unexpected(config_context.error());
+  }
+  const auto files = SourceDocumentIo::ListByExtension(input_path, ".txt");
+  if (!files) {
+    return std::unexpected(files.error());
+  }
+  const std::string config_hash = IngestConfigFingerprint((*config_context)->texts);
+
+  IngestManifestStore manifest_store(db_path.string());
+  std::map<std::string, IngestManifestEntry> manifest;
+  if (incremental) {
+    std::vector<IngestManifestEntry> entries;
+    try {
+      entries = manifest_store.Load();
+    } catch (const std::exception& error) {
+      return std::unexpected(MakeError(
+          "Failed to load ingest manifest: " + std::string(error.what()),
+          kContext));
+    }
+    for (auto& entry : entries) {
+      std::string source_path = entry.source_path;
+      manifest.emplace(std::move(source_path), std::move(entry));
+    }
+  }
+  // 先取确认时间再 stat 与读取：之后的写入会让下次比较时判定为竞态记录。
+  const std::int64_t verified_ns = IngestVerificationTimeNs();
+
+  // 1. 先比较 size/mtime，不读文件；只有元数据变化或上次记录处于竞态窗口的
+  //    文件才读取并比较内容哈希。
+  // 预留容量保证映射对象不会搬移，changed_documents 中的视图始终有效。
+  std::vector<MappedTextFile> changed_files;
+  changed_files.reserve(files->size());
+  SourceDocumentRefBatch changed_documents;
+  std::vector<IngestManifestEntry> changed_fingerprints;
+  IngestManifestUpdate update;
+  std::set<std::string> live_source_paths;
+  std::set<std::string> live_bill_dates;
+  std::size_t unchanged = 0U;
+  for (const auto& file_path : *files) {
+    const auto file_stat = StatIngestSource(file_path);
+    if (!file_stat) {
+      return std::unexpected(file_stat.error());
+    }
+    std::string source_path = ManifestSourcePath(file_path);
+    live_source_paths.insert(source_path);
+
+    const auto previous = manifest.find(source_path);
+    const bool reusable = previous != manifest.end() &&
+                          previous->second.bill_current &&
+                          previous->second.config_hash == config_hash &&
+                          previous->second.size == file_stat->size;
+    if (reusable && previous->second.mtime_ns == file_stat->mtime_ns &&
+        !IsRacyManifestEntry(previous->second)) {
+      live_bill_dates.insert(previous->second.bill_date);
+      ++unchanged;
+      continue;
+    }
+
+    auto mapped = MappedTextFile::Open(file_path);
+    if (!mapped) {
+      return std::unexpected(mapped.error());
+    }
+    IngestManifestEntry fingerprint;
+    fingerprint.source_path = std::move(source_path);
+    fingerprint.size = file_stat->size;
+    fingerprint.mtime_ns = file_stat->mtime_ns;
+    fingerprint.content_hash = FingerprintText(mapped->view());
+    fingerprint.config_hash = config_hash;
+    fingerprint.verified_ns = verified_ns;
+    if (reusable &&
+        previous->second.content_hash == fingerprint.content_hash) {
+      // 内容未变：修改时间变化（例如重新检出）或上次记录处于竞态窗口，
+      // 只刷新清单中的时间戳与确认时间。
+      fingerprint.bill_date = previous->second.bill_date;
+      live_bill_dates.insert(fingerprint.bill_date);
+      update.upserts.push_back(std::move(fingerprint));
+      ++unchanged;
+      continue;
+    }
+    const auto& changed_file = changed_files.emplace_back(std::move(*mapped));
+    changed_documents.push_back(SourceDocumentRef{
+        .display_path = file_path.string(),
+        .text = changed_file.view(),
+    });
+    changed_fingerprints.push_back(std::move(fingerprint));
+  }
+
+  // 2. 只解析指纹变化的文件；账单先暂存，与清单修改在同一事务中写入。
+  StagedBillRepository staged_bills;
+  BillWorkflowBatchResult result = BillWorkflowService::Ingest(
+      changed_documents, (*config_context)->validated.runtime_config,
+      staged_bills, include_serialized_json, jobs);
+  for (std::size_t index = 0U; index < result.files.size(); ++index) {
+    auto& fingerprint = changed_fingerprints[index];
+    if (!result.files[index].ok) {
+      // 失败文件保留旧清单记录，指纹不匹配，下次会重试；旧账单仍在库中。
+      const auto previous = manifest.find(fingerprint.source_path);
+      if (previous != manifest.end() && previous->second.bill_current) {
+        live_bill_dates.insert(previous->second.bill_date);
+      }
+      continue;
+    }
+    fingerprint.bill_date = bills::core::common::iso_period::format_year_month(
+        result.files[index].year, result.files[index].month);
+    live_bill_dates.insert(fingerprint.bill_date);
+    update.upserts.push_back(std::move(fingerprint));
+  }
+
+  // 3. 目录下已消失的源文件：移出清单，并删除仍由它写入、且没有其他
+  //    现存文件对应同一账期的账单。不在清单中的账单（如 import-json）不受影响。
+  if (incremental && std::filesystem::is_directory(input_path)) {
+    std::string scope = ManifestSourcePath(input_path);
+    if (!scope.ends_with('/')) {
+      scope.push_back('/');
+    }
+    for (const auto& [source_path, entry] : manifest) {
+      if (!source_path.starts_with(scope) ||
+          live_source_paths.contains(source_path)) {
+        continue;
+      }
+      update.dropped_paths.push_back(source_path);
+      if (entry.bill_current && !live_bill_dates.contains(entry.bill_date)) {
+        update.removed_bill_ids.push_back(entry.bill_id);
+      }
+    }
+  }
+
+  // 4. 账单与清单在同一事务中提交：失败时两者都保持原状，不会出现账单已写入
+  //    而清单仍是旧指纹的情况。
+  try {
+    BillInserter(db_path.string())
+        .insert_bills_atomically(staged_bills.bills(), update);
+  } catch (const std::exception& error) {
+    return std::unexpected(MakeError(
+        "Failed to write ingested bills and manifest: " +
+            std::string(error.what()),
+        kContext));
+  }
+  result.unchanged = unchanged;
+  result.removed = update.removed_bill_ids.size();
+  return result;
 }
 
 auto IngestDocumentsToDatabase(const std::filesystem::path& input_path,
@@ -1680,61 +2173,31 @@ auto ImportRecordDirectoryToWorkspace(const std::filesystem::path& input_path,
                                       const std::filesystem::path& config_dir,
                                       const std::filesystem::path& records_root)
     -> Result<HostRecordDirectoryImportResult> {
-  const auto preview_result = PreviewRecordDocuments(input_path, config_dir);
+  const auto runtime_config = LoadRuntimeConfig(config_dir);
+  if (!runtime_config) {
+    return std::unexpected(runtime_config.error());
+  }
+  const auto scanned = SourceDocumentIo::ScanByExtension(input_path, ".txt");
+  if (!scanned) {
+    return std::unexpected(scanned.error());
+  }
+  const auto preview_result =
+      PreviewLoadedRecordDocuments(scanned->documents, **runtime_config,
+                                   input_path);
   if (!preview_result) {
     return std::unexpected(preview_result.error());
   }
-  const auto source_views = LoadSourceDocumentViews(input_path);
-  if (!source_views) {
-    return std::unexpected(source_views.error());
-  }
 
   HostRecordDirectoryImportResult result;
-  result.processed = source_views->size();
-  if (preview_result->files.empty() && !source_views->empty()) {
+  result.processed = scanned->documents.size();
+  if (preview_result->files.empty() && !scanned->documents.empty()) {
     return std::unexpected(MakeError(
         "No preview results were returned for the provided TXT documents.",
         kContext));
   }
 
-  std::map<std::string, RecordPreviewFile> preview_by_path;
-  for (const auto& file : preview_result->files) {
-    preview_by_path.emplace(file.path, file);
-  }
-
-  std::vector<RecordImportCandidate> valid_candidates;
-  valid_candidates.reserve(source_views->size());
-  for (const auto& [absolute_path, view] : *source_views) {
-    const auto preview_it = preview_by_path.find(absolute_path);
-    if (preview_it == preview_by_path.end()) {
-      ++result.failure;
-      if (result.first_failure_message.empty()) {
-        result.first_failure_message =
-            "No validation result was returned for " + view.relative_path + ".";
-      }
-      continue;
-    }
-
-    const auto& preview_file = preview_it->second;
-    if (!preview_file.ok || preview_file.period.empty()) {
-      ++result.failure;
-      ++result.invalid;
-      if (result.first_failure_message.empty()) {
-        result.first_failure_message =
-            !preview_file.error.empty()
-                ? preview_file.error
-                : "TXT validation failed for " + view.relative_path + ".";
-      }
-      continue;
-    }
-
-    valid_candidates.push_back(RecordImportCandidate{
-        .absolute_path = absolute_path,
-        .relative_path = view.relative_path,
-        .period = preview_file.period,
-        .text = view.text,
-    });
-  }
+  const auto valid_candidates =
+      CollectRecordImportCandidates(*scanned, *preview_result, result);
 
   std::map<std::string, std::size_t> period_counts;
   for (const auto& candidate : valid_candidates) {
@@ -1749,7 +2212,7 @@ auto ImportRecordDirectoryToWorkspace(const std::filesystem::path& input_path,
         result.first_failure_message =
             "Duplicate period '" + candidate.period +
             "' was found in the selected directory for " +
-            candidate.relative_path + ".";
+            std::string(candidate.relative_path) + ".";
       }
       continue;
     }
@@ -1772,7 +2235,7 @@ auto ImportRecordDirectoryToWorkspace(const std::filesystem::path& input_path,
       ++result.failure;
       if (result.first_failure_message.empty()) {
         result.first_failure_message =
-            "Failed to write " + candidate.relative_path + " to " +
+            "Failed to write " + std::string(candidate.relative_path) + " to " +
             *target_relative + ": " + FormatError(write_result.error());
       }
       continue;
@@ -1830,71 +2293,49 @@ auto ImportRecordDirectoryAndSyncDatabase(
     const std::filesystem::path& db_path) -> HostRecordDirectoryImportResult {
   HostRecordDirectoryImportResult result;
 
-  const auto preview_result = PreviewRecordDocuments(input_path, config_dir);
-  if (!preview_result) {
+  const auto config_context = LoadValidatedConfigTextContext(config_dir);
+  if (!config_context) {
     result.failure = 1U;
-    result.first_failure_message = FormatError(preview_result.error());
+    result.first_failure_message = FormatError(config_context.error());
+    return result;
+  }
+  const auto scanned = SourceDocumentIo::ScanByExtension(input_path, ".txt");
+  if (!scanned) {
+    result.failure = 1U;
+    result.first_failure_message = FormatError(scanned.error());
     return result;
   }
-  const auto source_views = LoadSourceDocumentViews(input_path);
-  if (!source_views) {
+  const auto preview_result =
+      PreviewLoadedRecordDocuments(scanned->documents,
+                                   (*config_context)->validated.runtime_config,
+                                   input_path);
+  if (!preview_result) {
     result.failure = 1U;
-    result.first_failure_message = FormatError(source_views.error());
+    result.first_failure_message = FormatError(preview_result.error());
     return result;
   }
 
-  result.processed = source_views->size();
-  if (preview_result->files.empty() && !source_views->empty()) {
-    result.failure = source_views->size();
+  result.processed = scanned->documents.size();
+  if (preview_result->files.empty() && !scanned->documents.empty()) {
+    result.failure = scanned->documents.size();
     result.first_failure_message =
         "No preview results were returned for the provided TXT documents.";
     return result;
   }
 
-  std::map<std::string, RecordPreviewFile> preview_by_path;
-  for (const auto& file : preview_result->files) {
-    preview_by_path.emplace(file.path, file);
-  }
-
-  std::vector<RecordImportCandidate> valid_candidates;
-  valid_candidates.reserve(source_views->size());
-  for (const auto& [absolute_path, view] : *source_views) {
-    const auto preview_it = preview_by_path.find(absolute_path);
-    if (preview_it == preview_by_path.end()) {
-      ++result.failure;
-      if (result.first_failure_message.empty()) {
-        result.first_failure_message =
-            "No validation result was returned for " + view.relative_path + ".";
-      }
-      continue;
-    }
-
-    const auto& preview_file = preview_it->second;
-    if (!preview_file.ok || preview_file.period.empty()) {
-      ++result.failure;
-      ++result.invalid;
-      if (result.first_failure_message.empty()) {
-        result.first_failure_message =
-            !preview_file.error.empty()
-                ? preview_file.error
-                : "TXT validation failed for " + view.relative_path + ".";
-      }
-      continue;
-    }
-
-    valid_candidates.push_back(RecordImportCandidate{
-        .absolute_path = absolute_path,
-        .relative_path = view.relative_path,
-        .period = preview_file.period,
-        .text = view.text,
-    });
-  }
+  const auto valid_candidates =
+      CollectRecordImportCandidates(*scanned, *preview_result, result);
 
   std::map<std::string, std::size_t> period_counts;
   for (const auto& candidate : valid_candidates) {
     ++period_counts[candidate.period];
   }
 
+  // 重复账期与无法定位目标路径的记录不参与提交，其余记录整批提交。
+  std::vector<RecordImportCandidate> commit_candidates;
+  SourceDocumentBatch commit_targets;
+  commit_candidates.reserve(valid_candidates.size());
+  commit_targets.reserve(valid_candidates.size());
   for (const auto& candidate : valid_candidates) {
     if (period_counts[candidate.period] > 1U) {
       ++result.failure;
@@ -1903,29 +2344,41 @@ auto ImportRecordDirectoryAndSyncDatabase(
         result.first_failure_message =
             "Duplicate period '" + candidate.period +
             "' was found in the selected directory for " +
-            candidate.relative_path + ".";
+            std::string(candidate.relative_path) + ".";
       }
       continue;
     }
 
-    const auto commit_result = CommitValidatedRecordTextToWorkspaceAndDatabase(
-        candidate.period, candidate.text, config_dir, records_root, db_path);
-    if (!commit_result.ok) {
+    auto target_relative = BuildRecordWorkspaceRelativePath(candidate.period);
+    if (!target_relative) {
       ++result.failure;
       if (result.first_failure_message.empty()) {
-        result.first_failure_message =
-            !commit_result.error_message.empty() ? commit_result.error_message
-                                                 : commit_result.message;
+        result.first_failure_message = FormatError(target_relative.error());
       }
       continue;
     }
+    commit_candidates.push_back(candidate);
+    commit_targets.push_back(SourceDocument{
+        .display_path = std::move(*target_relative),
+        .text = {},
+    });
+  }
+  if (commit_candidates.empty()) {
+    return result;
+  }
 
-    ++result.imported;
-    if (commit_result.overwritten) {
-      ++result.overwritten;
+  const auto overwritten = CommitRecordBatchToWorkspaceAndDatabase(
+      commit_candidates, commit_targets, **config_context, records_root,
+      db_path);
+  if (!overwritten) {
+    result.failure += commit_candidates.size();
+    if (result.first_failure_message.empty()) {
+      result.first_failure_message = FormatError(overwritten.error());
     }
+    return result;
   }
-
+  result.imported = commit_candidates.size();
+  result.overwritten = *overwritten;
   return result;
 }
 
@@ -1987,7 +2440,7 @@ auto PreflightImportDocuments(
     const std::vector<std::string>& existing_workspace_periods,
     const std::vector<std::string>& existing_db_periods)
     -> Result<ImportPreflightResult> {
-  const auto validated_context = LoadValidatedConfigContext(config_dir);
+  const auto validated_context = LoadValidatedConfigTextContext(config_dir);
   if (!validated_context) {
     return std::unexpected(validated_context.error());
   }
@@ -1998,8 +2451,8 @@ auto PreflightImportDocuments(
   ImportPreflightRequest request;
   request.input_label = input_path.string();
   request.documents = *documents;
-  request.config_validation = validated_context->validated.report;
-  request.config_bundle = validated_context->validated.runtime_config;
+  request.config_validation = (*validated_context)->validated.report;
+  request.config_bundle = (*validated_context)->validated.runtime_config;
   request.existing_workspace_periods = existing_workspace_periods;
   request.existing_db_periods = existing_db_periods;
   const auto result = ImportPreflightService::Run(request);
@@ -2054,6 +2507,32 @@ auto QueryMonthReport(const std::filesystem::path& db_path,
   }
 }
 
+auto QueryRangeReport(const std::filesystem::path& db_path,
+                      std::string_view start_iso_month,
+                      std::string_view end_iso_month) -> Result<HostQueryResult> {
+  try {
+    auto db_session = bills::io::CreateReportDbSession(db_path.string());
+    auto report_data_gateway =
+        bills::io::CreateReportDataGateway(db_session->GetConnectionHandle());
+    const auto query_result = QueryService::QueryRange(
+        *report_data_gateway, start_iso_month, end_iso_month);
+    if (!query_result.data_found) {
+      return HostQueryResult{.execution = query_result};
+    }
+    return BuildHostQueryResult(query_result, query_result.query_value,
+                                db_session->GetConnectionHandle());
+  } catch (const std::exception& error) {
+    if (IsMissingBillsTableError(error.what())) {
+      QueryExecutionResult query_result;
+      query_result.query_type = "range";
+      query_result.query_value =
+          std::string(start_iso_month) + ".." + std::string(end_iso_month);
+      return HostQueryResult{.execution = query_result};
+    }
+    return std::unexpected(MakeError(error.what(), kContext));
+  }
+}
+
 auto ListAvailableMonths(const std::filesystem::path& db_path)
     -> Result<std::vector<std::string>> {
   if (!std::filesystem::exists(db_path)) {
@@ -2170,36 +2649,41 @@ auto ExportReports(const HostReportExportRequest& request)
       break;
   }
 
+  ReportExportPlan plan;
+  switch (request.scope) {
+    case HostReportExportScope::kYear:
+      plan = export_service.plan_yearly_report(*normalized_year);
+      break;
+    case HostReportExportScope::kMonth:
+      plan = export_service.plan_monthly_report(*normalized_month);
+      break;
+    case HostReportExportScope::kRange:
+      plan = export_service.plan_monthly_range(*normalized_range);
+      break;
+    case HostReportExportScope::kAllMonths:
+      plan = export_service.plan_all_monthly_reports();
+      break;
+    case HostReportExportScope::kAllYears:
+      plan = export_service.plan_all_yearly_reports();
+      break;
+    case HostReportExportScope::kAll:
+      plan = export_service.plan_all_reports();
+      break;
+  }
+
+  // 所有格式共用同一份查询结果，每个账期只组装一次 StandardReport。
+  const auto format_results =
+      export_service.export_plan(plan, request.formats, request.jobs,
+                                 request.incremental);
+
   HostReportExportResult result;
   result.attempted_formats = request.formats;
   result.export_dir = request.export_dir;
-  for (const auto& format : request.formats) {
-    ReportExportRunResult current_result;
-    switch (request.scope) {
-      case HostReportExportScope::kYear:
-        current_result = export_service.export_yearly_report(*normalized_year, format);
-        break;
-      case HostReportExportScope::kMonth:
-        current_result =
-            export_service.export_monthly_report(*normalized_month, format);
-        break;
-      case HostReportExportScope::kRange:
-        current_result =
-            export_service.export_monthly_range(*normalized_range, format);
-        break;
-      case HostReportExportScope::kAllMonths:
-        current_result = export_service.export_all_monthly_reports(format);
-        break;
-      case HostReportExportScope::kAllYears:
-        current_result = export_service.export_all_yearly_reports(format);
-        break;
-      case HostReportExportScope::kAll:
-        current_result = export_service.export_all_reports(format);
-        break;
-    }
-    result.exported_count += current_result.exported_count;
-    if (!current_result.ok) {
-      result.failed_formats.push_back(format);
+  for (std::size_t index = 0U; index < request.formats.size(); ++index) {
+    result.exported_count += format_results[index].exported_count;
+    result.unchanged_count += format_results[index].unchanged_count;
+    if (!format_results[index].ok) {
+      result.failed_formats.push_back(request.formats[index]);
     }
   }
   result.ok = result.failed_formats.empty();
@@ -2229,7 +2713,7 @@ auto ExportParseBundle(const std::filesystem::path& records_root,
     return std::unexpected(record_documents.error());
   }
   const auto validation_result = ValidateRecordDocuments(
-      *record_documents, config_context->validated.runtime_config,
+      *record_documents, (*config_context)->validated.runtime_config,
       "TXT validation failed for parse bundle");
   if (!validation_result) {
     return std::unexpected(validation_result.error());
@@ -2243,15 +2727,15 @@ auto ExportParseBundle(const std::filesystem::path& records_root,
   });
   archive_entries.push_back(ZipArchiveTextEntry{
       .archive_path = std::string(kConfigPrefix) + std::string(kConfigFileNames[0]),
-      .text = config_context->texts.validator_text,
+      .text = (*config_context)->texts.validator_text,
   });
   archive_entries.push_back(ZipArchiveTextEntry{
       .archive_path = std::string(kConfigPrefix) + std::string(kConfigFileNames[1]),
-      .text = config_context->texts.modifier_text,
+      .text = (*config_context)->texts.modifier_text,
   });
   archive_entries.push_back(ZipArchiveTextEntry{
       .archive_path = std::string(kConfigPrefix) + std::string(kConfigFileNames[2]),
-      .text = config_context->texts.export_formats_text,
+      .text = (*config_context)->texts.export_formats_text,
   });
   for (const auto& document : *record_documents) {
     archive_entries.push_back(ZipArchiveTextEntry{
@@ -2423,7 +2907,7 @@ auto ExportBackupBundle(const std::filesystem::path& records_root,
     return std::unexpected(record_documents.error());
   }
   const auto validation_result = ValidateRecordDocuments(
-      *record_documents, config_context->validated.runtime_config,
+      *record_documents, (*config_context)->validated.runtime_config,
       "TXT validation failed for backup bundle");
   if (!validation_result) {
     return std::unexpected(validation_result.error());
@@ -2439,12 +2923,12 @@ auto ExportBackupBundle(const std::filesystem::path& records_root,
   archive_entries.push_back(ZipArchiveTextEntry{
       .archive_path =
           std::string(kConfigPrefix) + std::string(kBackupConfigFileNames[0]),
-      .text = config_context->texts.validator_text,
+      .text = (*config_context)->texts.validator_text,
   });
   archive_entries.push_back(ZipArchiveTextEntry{
       .archive_path =
           std::string(kConfigPrefix) + std::string(kBackupConfigFileNames[1]),
-      .text = config_context->texts.modifier_text,
+      .text = (*config_context)->texts.modifier_text,
   });
   for (const auto& document : *record_documents) {
     archive_entries.push_back(ZipArchiveTextEntry{
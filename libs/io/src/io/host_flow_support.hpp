@@ -1,6 +1,7 @@
 #ifndef BILLS_IO_HOST_FLOW_SUPPORT_HPP_
 #define BILLS_IO_HOST_FLOW_SUPPORT_HPP_
 
+#include <cstddef>
 #include <filesystem>
 #include <map>
 #include <optional>
@@ -135,6 +136,10 @@ struct HostReportExportRequest {
   std::filesystem::path db_path;
   std::filesystem::path export_dir;
   std::map<std::string, std::string> format_folder_names;
+  // 渲染线程数，0 表示使用硬件并发数。
+  std::size_t jobs = 0U;
+  // 跳过报表内容与导出目录清单一致的账期，不重新渲染也不改写文件。
+  bool incremental = false;
 };
 
 struct HostReportExportResult {
@@ -142,9 +147,15 @@ struct HostReportExportResult {
   std::vector<std::string> attempted_formats;
   std::vector<std::string> failed_formats;
   std::size_t exported_count = 0U;
+  // exported_count 中因内容未变而跳过的报表数。
+  std::size_t unchanged_count = 0U;
   std::filesystem::path export_dir;
 };
 
+// 选择之后打开的 SQLite 连接所用的性能档位：default、balanced 或 bulk。
+[[nodiscard]] auto SelectDatabaseProfile(std::string_view profile_name)
+    -> Result<void>;
+
 [[nodiscard]] auto LoadValidatedConfigContext(
     const std::filesystem::path& config_dir) -> Result<HostConfigContext>;
 
@@ -175,19 +186,27 @@ struct HostReportExportResult {
 [[nodiscard]] auto ListRecordPeriods(const std::filesystem::path& input_path)
     -> Result<ListedPeriodsResult>;
 
+// jobs: 文档解析的工作线程数，0 表示使用硬件并发数。
 [[nodiscard]] auto ValidateDocuments(const std::filesystem::path& input_path,
-                                     const std::filesystem::path& config_dir)
+                                     const std::filesystem::path& config_dir,
+                                     std::size_t jobs = 1U)
     -> Result<BillWorkflowBatchResult>;
 
 [[nodiscard]] auto ConvertDocuments(const std::filesystem::path& input_path,
                                     const std::filesystem::path& config_dir,
-                                    bool include_serialized_json = false)
+                                    bool include_serialized_json = false,
+                                    std::size_t jobs = 1U)
     -> Result<BillWorkflowBatchResult>;
 
+// 每次入库都会把成功文件的指纹（size/mtime/内容哈希/配置哈希）记入库内清单。
+// incremental: 跳过指纹未变的文件，并删除目录下已消失文件所写入的账期；
+// 未变与删除的数量记入 unchanged/removed，processed 只统计实际处理的文件。
 [[nodiscard]] auto IngestDocuments(const std::filesystem::path& input_path,
                                    const std::filesystem::path& config_dir,
                                    const std::filesystem::path& db_path,
-                                   bool include_serialized_json = false)
+                                   bool include_serialized_json = false,
+                                   std::size_t jobs = 1U,
+                                   bool incremental = false)
     -> Result<BillWorkflowBatchResult>;
 
 [[nodiscard]] auto IngestDocumentsToDatabase(
@@ -213,6 +232,8 @@ struct HostReportExportResult {
     const std::filesystem::path& records_root,
     const std::filesystem::path& db_path) -> HostRecordCommitResult;
 
+// 未通过校验或账期重复的文件计入失败，其余文件整批提交：工作区文件与
+// SQLite（单一事务）要么全部更新，要么在任一步失败时全部恢复原状。
 [[nodiscard]] auto ImportRecordDirectoryAndSyncDatabase(
     const std::filesystem::path& input_path,
     const std::filesystem::path& config_dir,
@@ -243,6 +264,12 @@ struct HostReportExportResult {
                                     std::string_view iso_month)
     -> Result<HostQueryResult>;
 
+// 单次分组查询汇总 [start_iso_month, end_iso_month] 闭区间，均为 YYYY-MM。
+[[nodiscard]] auto QueryRangeReport(const std::filesystem::path& db_path,
+                                    std::string_view start_iso_month,
+                                    std::string_view end_iso_month)
+    -> Result<HostQueryResult>;
+
 [[nodiscard]] auto ListAvailableMonths(const std::filesystem::path& db_path)
     -> Result<std::vector<std::string>>;
 
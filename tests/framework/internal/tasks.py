@@ -265,6 +265,18 @@ class QueryTasks:
             "5_query_month.log",
         ):
             return False
+        if not self.executor.run(
+            "Query Range",
+            [
+                "report",
+                "show",
+                "range",
+                config.TEST_DATES["range_start"],
+                config.TEST_DATES["range_end"],
+            ],
+            "5_query_range.log",
+        ):
+            return False
         return True
 
 
@@ -823,3 +835,348 @@ class BundleTasks:
         if not self.executor.records:
             return
         self.executor.records[-1]["status"] = "expected_fail"
+
+
+class IncrementalTasks:
+    """增量类：重复执行 ingest/export，校验 unchanged/removed 计数与未改写的导出文件。"""
+
+    def __init__(self, executor, bills_path, run_output_root):
+        self.executor = executor
+        self.bills_path = Path(bills_path)
+        self.run_output_root = Path(run_output_root)
+        self.working_bills_dir = self.run_output_root / "incremental_bills"
+
+    def run(self):
+        print(f"{constants.CYAN}--- 8. Running Incremental Tasks ---{constants.RESET}")
+        if self.working_bills_dir.exists():
+            shutil.rmtree(self.working_bills_dir)
+        # copytree 保留 mtime，使清单指纹在重复入库之间保持稳定。
+        shutil.copytree(self.bills_path, self.working_bills_dir)
+        bill_files = sorted(self.working_bills_dir.rglob("*.txt"))
+        if not bill_files:
+            print(f" ... {constants.RED}CRITICAL FAILURE{constants.RESET}")
+            print(
+                f"      {constants.RED}错误: 增量测试目录中没有 txt 账单: '{self.working_bills_dir}'{constants.RESET}"
+            )
+            return False
+        total = len(bill_files)
+        ingest_args = ["workspace", "ingest", str(self.working_bills_dir)]
+        incremental_args = ingest_args + ["--incremental"]
+
+        if not self.executor.run(
+            "Ingest Initial (Jobs)",
+            incremental_args + ["--jobs", "2", "--db-profile", "bulk"],
+            "33_ingest_initial.log",
+        ):
+            return False
+        if not self._assert_log_contains(
+            "33_ingest_initial.log", f"processed={total}, success={total}, failure=0"
+        ):
+            return False
+
+        if not self.executor.run(
+            "Ingest Incremental",
+            incremental_args + ["--db-profile", "default"],
+            "34_ingest_incremental.log",
+        ):
+            return False
+        if not self._assert_log_contains(
+            "34_ingest_incremental.log",
+            f"processed=0, success=0, failure=0, unchanged={total}, removed=0",
+        ):
+            return False
+
+        if not self.executor.run(
+            "Ingest Full",
+            ingest_args + ["--db-profile", "balanced"],
+            "35_ingest_full.log",
+        ):
+            return False
+        if not self._assert_log_contains(
+            "35_ingest_full.log", f"processed={total}, success={total}, failure=0"
+        ):
+            return False
+        if not self._assert_log_not_contains("35_ingest_full.log", "unchanged="):
+            return False
+
+        removed_file = bill_files[0]
+        removed_backup = removed_file.with_suffix(".removed")
+        shutil.move(str(removed_file), str(removed_backup))
+        if not self.executor.run(
+            "Ingest Removed",
+            incremental_args,
+            "36_ingest_removed.log",
+        ):
+            return False
+        if not self._assert_log_contains(
+            "36_ingest_removed.log",
+            f"processed=0, success=0, failure=0, unchanged={total - 1}, removed=1",
+        ):
+            return False
+
+        shutil.move(str(removed_backup), str(removed_file))
+        if not self.executor.run(
+            "Ingest Restored",
+            incremental_args,
+            "37_ingest_restored.log",
+        ):
+            return False
+        if not self._assert_log_contains(
+            "37_ingest_restored.log",
+            f"processed=1, success=1, failure=0, unchanged={total - 1}, removed=0",
+        ):
+            return False
+
+        if not self.executor.run_expected_failure(
+            "Ingest Invalid Profile",
+            ingest_args + ["--db-profile", "turbo"],
+            "38_ingest_invalid_profile.log",
+        ):
+            return False
+        if not self._assert_log_contains(
+            "38_ingest_invalid_profile.log", "Unknown database profile 'turbo'"
+        ):
+            return False
+
+        return self._run_export_tasks()
+
+    def _run_export_tasks(self):
+        if not config.EXPORT_FORMATS:
+            return True
+        fmt = config.EXPORT_FORMATS[0]
+        export_args = ["report", "export", "all-months", "--format", fmt, "--incremental"]
+
+        if not self.executor.run(
+            f"Export Incremental ({fmt.upper()})",
+            export_args,
+            "39_export_incremental.log",
+        ):
+            return False
+        exported_count, export_dir = self._parse_export_summary("39_export_incremental.log")
+        if exported_count is None:
+            return False
+
+        snapshot = self._snapshot_files(export_dir)
+        if not self.executor.run(
+            f"Export Unchanged ({fmt.upper()})",
+            export_args,
+            "40_export_unchanged.log",
+        ):
+            return False
+        if not self._assert_log_contains(
+            "40_export_unchanged.log",
+            f"Exported {exported_count} report(s) to {export_dir} ({exported_count} unchanged)",
+        ):
+            return False
+        if self._snapshot_files(export_dir) != snapshot:
+            print(f" ... {constants.RED}CRITICAL FAILURE{constants.RESET}")
+            print(
+                f"      {constants.RED}错误: 内容未变的增量导出改写了导出目录: '{export_dir}'{constants.RESET}"
+            )
+            return False
+        return True
+
+    def _parse_export_summary(self, log_filename):
+        prefix = "Exported "
+        marker = " report(s) to "
+        for line in self.executor.read_log_text(log_filename).splitlines():
+            if not line.startswith(prefix) or marker not in line:
+                continue
+            count_text, remainder = line[len(prefix):].split(marker, 1)
+            export_dir = remainder.rsplit(" (", 1)[0]
+            if count_text.isdigit() and int(count_text) > 0:
+                return int(count_text), export_dir
+        print(f" ... {constants.RED}CRITICAL FAILURE{constants.RESET}")
+        print(
+            f"      {constants.RED}错误: 日志 '{log_filename}' 未包含有效的导出摘要。{constants.RESET}"
+        )
+        return None, None
+
+    def _snapshot_files(self, root):
+        root_path = Path(root)
+        return {
+            str(path.relative_to(root_path)): (path.stat().st_mtime_ns, path.stat().st_size)
+            for path in root_path.rglob("*")
+            if path.is_file()
+        }
+
+    def _assert_log_contains(self, log_filename, expected_text):
+        log_text = self.executor.read_log_text(log_filename)
+        if expected_text in log_text:
+            return True
+        print(f" ... {constants.RED}CRITICAL FAILURE{constants.RESET}")
+        print(
+            f"      {constants.RED}错误: 日志 '{log_filename}' 未包含期望内容: "
+            f"'{expected_text}'{constants.RESET}"
+        )
+        return False
+
+    def _assert_log_not_contains(self, log_filename, unexpected_text):
+        log_text = self.executor.read_log_text(log_filename)
+        if unexpected_text not in log_text:
+            return True
+        print(f" ... {constants.RED}CRITICAL FAILURE{constants.RESET}")
+        print(
+            f"      {constants.RED}错误: 日志 '{log_filename}' 包含了不应出现的内容: "
+            f"'{unexpected_text}'{constants.RESET}"
+        )
+        return False
+
+
+def _golden_bill_bytes(
+    period, parent, sub, body, newline=b"\n", prefix=b"", remark=b"golden"
+):
+    """按账单 TXT 布局拼出单父类、单子类的字节输入。"""
+    lines = [
+        b"date:" + period.encode("ascii"),
+        b"remark:" + remark,
+        b"",
+        parent.encode("ascii"),
+        b"",
+        sub.encode("ascii"),
+        *body,
+    ]
+    return prefix + newline.join(lines) + newline
+
+
+def _golden_meal(period, *body, **layout):
+    return period, _golden_bill_bytes(period, "meal", "meal_low", list(body), **layout)
+
+
+def _golden_refund(period, *body, **layout):
+    return period, _golden_bill_bytes(period, "income", "income_refunds", list(body), **layout)
+
+
+class ParseGoldenTasks:
+    """解析 golden 类：以构造的字节输入执行 template preview，逐文件核对解析合计。"""
+
+    # ((period, 文件字节), 期望摘要)。期望值与重写前的解析器逐字一致。
+    _VALID_CASES = [
+        (_golden_meal("2031-01", b"3-4+7+10 chain"), "txns=1 | income=0 | expense=-10 | balance=-10"),
+        (_golden_meal("2031-02", b"+3-4+7+10 plus"), "txns=1 | income=0 | expense=-16 | balance=-16"),
+        (_golden_meal("2031-03", b"-3-4+7+10 minus"), "txns=1 | income=0 | expense=-10 | balance=-10"),
+        (_golden_meal("2031-04", b"12 + 0.5 - 2 spaced"), "txns=1 | income=0 | expense=-13.5 | balance=-13.5"),
+        (_golden_refund("2031-05", b"3-4 refund"), "txns=1 | income=7 | expense=0 | balance=7"),
+        (_golden_refund("2031-06", b"+3-4 refund"), "txns=1 | income=1 | expense=0 | balance=1"),
+        (_golden_meal("2031-07", b"8- dangling"), "txns=1 | income=0 | expense=-8 | balance=-8"),
+        (_golden_meal("2031-08", b"1.5.5 dots"), "txns=1 | income=0 | expense=-1.5 | balance=-1.5"),
+        (_golden_meal("2031-09", b"12.34-0.34// note"), "txns=1 | income=0 | expense=-12.68 | balance=-12.68"),
+        (_golden_meal("2031-10", b"0.1+0.2 float"), "txns=1 | income=0 | expense=-0.1 | balance=-0.1"),
+        (
+            _golden_meal("2032-03", b"12.5 lunch", b"3.25 snack", newline=b"\r"),
+            "txns=2 | income=0 | expense=-15.75 | balance=-15.75",
+        ),
+        (
+            _golden_meal("2032-04", b"12.5 lunch", b"3.25 snack", newline=b"\r\n"),
+            "txns=2 | income=0 | expense=-15.75 | balance=-15.75",
+        ),
+        (
+            _golden_meal("2032-05", b"10 lunch", prefix=b"\xef\xbb\xbf"),
+            "txns=1 | income=0 | expense=-10 | balance=-10",
+        ),
+        (
+            _golden_meal("2032-06", b"10 lunch", newline=b"\r\n", prefix=b"\xef\xbb\xbf"),
+            "txns=1 | income=0 | expense=-10 | balance=-10",
+        ),
+        (_golden_meal("2031-11", b"2*3+4 star"), "txns=1 | income=0 | expense=-2 | balance=-2"),
+        (_golden_meal("2031-12", "2×3-1 times".encode()), "txns=1 | income=0 | expense=-7 | balance=-7"),
+        (
+            _golden_meal("2032-01", "1.5 × 2 × 2 spaced-times".encode()),
+            "txns=1 | income=0 | expense=-6 | balance=-6",
+        ),
+        (_golden_meal("2032-02", b"+2*3 plus-star"), "txns=1 | income=0 | expense=-6 | balance=-6"),
+        (
+            _golden_meal("2032-07", b"0." + b"0" * 330 + b"5 subnormal", b"1 one"),
+            "txns=2 | income=0 | expense=-1 | balance=-1",
+        ),
+        (
+            _golden_meal("2032-08", b"1" + b"0" * 400 + b" overflow", b"1 one"),
+            "txns=2 | income=0 | expense=-1 | balance=-1",
+        ),
+        (
+            _golden_meal("2032-09", b"0.004 rounds-to-zero", b"0.005 half"),
+            "txns=2 | income=0 | expense=-0.01 | balance=-0.01",
+        ),
+    ]
+
+    # ((period, 文件字节), 期望错误)。每个文件都应失败，且不影响同批其他文件。
+    _INVALID_CASES = [
+        (
+            _golden_meal("2033-01", b"10 caf\xe9"),
+            "normalize_text: Input text must be valid UTF-8. "
+            "Truncated UTF-8 sequence at byte offset 49.",
+        ),
+        (
+            _golden_meal("2033-03", b"10 ok", remark=b"\xff\xfe"),
+            "normalize_text: Input text must be valid UTF-8. "
+            "Invalid UTF-8 lead byte at byte offset 20.",
+        ),
+        (
+            _golden_meal("2033-02", b"99999999999999999999 huge"),
+            "convert_content: 金额超出可表示范围。",
+        ),
+    ]
+
+    def __init__(self, executor, run_output_root):
+        self.executor = executor
+        self.input_root = Path(run_output_root) / "parse_golden"
+
+    def run(self):
+        print(f"{constants.CYAN}--- 9. Running Parse Golden Tasks ---{constants.RESET}")
+        if self.input_root.exists():
+            shutil.rmtree(self.input_root)
+
+        valid_dir = self._write_cases("valid", self._VALID_CASES)
+        if not self.executor.run(
+            "Parse Golden (Valid)",
+            ["template", "preview", str(valid_dir)],
+            "41_parse_golden_valid.log",
+        ):
+            return False
+        for (period, _), expected_summary in self._VALID_CASES:
+            if not self._assert_log_contains(
+                "41_parse_golden_valid.log", f"period={period} | {expected_summary}"
+            ):
+                return False
+        total = len(self._VALID_CASES)
+        if not self._assert_log_contains(
+            "41_parse_golden_valid.log",
+            f"Processed: {total}, Success: {total}, Failure: 0",
+        ):
+            return False
+
+        invalid_dir = self._write_cases("invalid", self._INVALID_CASES)
+        if not self.executor.run_expected_failure(
+            "Parse Golden (Invalid)",
+            ["template", "preview", str(invalid_dir)],
+            "42_parse_golden_invalid.log",
+        ):
+            return False
+        for (period, _), expected_error in self._INVALID_CASES:
+            if not self._assert_log_contains(
+                "42_parse_golden_invalid.log", f"{period}.txt | {expected_error}"
+            ):
+                return False
+        total = len(self._INVALID_CASES)
+        return self._assert_log_contains(
+            "42_parse_golden_invalid.log",
+            f"Processed: {total}, Success: 0, Failure: {total}",
+        )
+
+    def _write_cases(self, set_name, cases):
+        case_dir = self.input_root / set_name
+        case_dir.mkdir(parents=True, exist_ok=True)
+        for (period, content), _ in cases:
+            (case_dir / f"{period}.txt").write_bytes(content)
+        return case_dir
+
+    def _assert_log_contains(self, log_filename, expected_text):
+        log_text = self.executor.read_log_text(log_filename)
+        if expected_text in log_text:
+            return True
+        print(f" ... {constants.RED}CRITICAL FAILURE{constants.RESET}")
+        print(
+            f"      {constants.RED}错误: 日志 '{log_filename}' 未包含期望内容: "
+            f"'{expected_text}'{constants.RESET}"
+        )
+        return False
@@ -24,6 +24,8 @@ MetadataTasks: Any = None
 QueryTasks: Any = None
 RecordTasks: Any = None
 BundleTasks: Any = None
+IncrementalTasks: Any = None
+ParseGoldenTasks: Any = None
 
 
 def _bootstrap_imports() -> None:
@@ -40,6 +42,8 @@ def _bootstrap_imports() -> None:
     global QueryTasks
     global RecordTasks
     global BundleTasks
+    global IncrementalTasks
+    global ParseGoldenTasks
 
     build_layout = importlib.import_module("tools.toolchain.services.build_layout")
     framework_config = importlib.import_module("framework.internal.app_config")
@@ -61,6 +65,8 @@ def _bootstrap_imports() -> None:
     QueryTasks = tasks_module.QueryTasks
     RecordTasks = tasks_module.RecordTasks
     BundleTasks = tasks_module.BundleTasks
+    IncrementalTasks = tasks_module.IncrementalTasks
+    ParseGoldenTasks = tasks_module.ParseGoldenTasks
 
 
 _bootstrap_imports()
@@ -137,6 +143,8 @@ def prepare_run_output_root(run_output_root: Path, summary_path: Path) -> None:
         run_output_root / "bundles",
         run_output_root / "txt2josn",
         run_output_root / "exported_files",
+        run_output_root / "incremental_bills",
+        run_output_root / "parse_golden",
     ]
     cleanup_files = [
         run_output_root / "test_python_output.log",
@@ -329,6 +337,8 @@ def run_test_sequence(runtime_base_dir: Path, preparer, run_output_root: Path):
         runtime_base_dir,
         str(run_output_root),
     )
+    incremental_tasks = IncrementalTasks(executor, config.BILLS_DIR, str(run_output_root))
+    parse_golden_tasks = ParseGoldenTasks(executor, str(run_output_root))
 
     # --- 执行测试序列 ---
     print(f"\n{constants.CYAN}========== Starting Test Sequence =========={constants.RESET}")
@@ -347,6 +357,10 @@ def run_test_sequence(runtime_base_dir: Path, preparer, run_output_root: Path):
         final_result = record_tasks.run()
     if final_result:
         final_result = bundle_tasks.run()
+    if final_result:
+        final_result = incremental_tasks.run()
+    if final_result:
+        final_result = parse_golden_tasks.run()
 
     # --- 报告最终结果 ---
     if final_result:
@@ -5,6 +5,8 @@ import sys
 
 import pandas as pd
 
+# 金额列保存整数分（schema v4 起），查询结果换算回元。
+
 
 def fetch_yearly_data(db_path: str, year: int):
     """
@@ -19,7 +21,7 @@ def fetch_yearly_data(db_path: str, year: int):
         query = """
         SELECT
             b.month,
-            SUM(t.amount) AS total_expenses
+            SUM(t.amount) / 100.0 AS total_expenses
         FROM
             transactions t
         JOIN
@@ -52,7 +54,7 @@ def fetch_monthly_data(db_path: str, month: str):
         query = """
         SELECT
             t.parent_category,
-            SUM(t.amount) AS total_expenses
+            SUM(t.amount) / 100.0 AS total_expenses
         FROM
             transactions t
         JOIN
@@ -89,7 +91,7 @@ def fetch_monthly_details_data(db_path: str, month: str):
             parent_category,
             description,
             sub_category,
-            amount
+            amount / 100.0 AS amount
         FROM
             transactions t
         JOIN
@@ -0,0 +1,126 @@
+"""按 SQLite 性能档位对比 ingest 与报表导出（查询）耗时。
+
+每个档位、每轮都使用全新的临时 runtime workspace：先全量 ingest 记录目录，
+再 `report export all` 读取全部账期。两步均以子进程计时，包含进程启动开销。
+"""
+
+import argparse
+import json
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+PROFILES = ("default", "balanced", "bulk")
+WORKSPACE_ENV = "BILLS_TRACER_RUNTIME_WORKSPACE_DIR"
+PROFILE_ENV = "BILLS_TRACER_DB_PROFILE"
+
+
+def parse_args() -> argparse.Namespace:
+    parser = argparse.ArgumentParser(description="SQLite 性能档位 ingest/query 基准")
+    parser.add_argument("--cli", required=True, help="bills_tracer_cli 可执行文件路径")
+    parser.add_argument("--bills", required=True, help="TXT 记录目录")
+    parser.add_argument(
+        "--profiles",
+        default=",".join(PROFILES),
+        help="逗号分隔的档位列表，默认 default,balanced,bulk",
+    )
+    parser.add_argument("--repeat", type=int, default=3, help="每个档位的轮数")
+    parser.add_argument("--jobs", type=int, default=0, help="ingest 解析线程数，0 为硬件并发数")
+    parser.add_argument("--format", default="json", help="导出格式")
+    parser.add_argument("--json-out", help="可选：把每轮耗时写入该 JSON 文件")
+    return parser.parse_args()
+
+
+def run_timed(command: list[str], cwd: Path, env: dict[str, str]) -> float:
+    start = time.perf_counter()
+    result = subprocess.run(
+        command, cwd=cwd, env=env, capture_output=True, text=True, errors="ignore"
+    )
+    elapsed = time.perf_counter() - start
+    if result.returncode != 0:
+        raise RuntimeError(
+            f"命令失败 ({result.returncode}): {' '.join(command)}\n{result.stderr}"
+        )
+    return elapsed
+
+
+def bench_profile(args: argparse.Namespace, cli_path: Path, bills_dir: Path, profile: str) -> dict:
+    samples = {"ingest": [], "query": []}
+    for _ in range(args.repeat):
+        with tempfile.TemporaryDirectory(prefix=f"bills_db_{profile}_") as workspace:
+            env = dict(os.environ)
+            env[WORKSPACE_ENV] = workspace
+            env[PROFILE_ENV] = profile
+            # 非 Windows 下 CLI 以工作目录作为可执行文件目录查找 config/。
+            cwd = cli_path.parent
+            samples["ingest"].append(
+                run_timed(
+                    [
+                        str(cli_path),
+                        "workspace",
+                        "ingest",
+                        str(bills_dir),
+                        "--jobs",
+                        str(args.jobs),
+                        "--db-profile",
+                        profile,
+                    ],
+                    cwd,
+                    env,
+                )
+            )
+            samples["query"].append(
+                run_timed(
+                    [str(cli_path), "report", "export", "all", "--format", args.format],
+                    cwd,
+                    env,
+                )
+            )
+    return samples
+
+
+def main() -> int:
+    args = parse_args()
+    cli_path = Path(args.cli).resolve()
+    bills_dir = Path(args.bills).resolve()
+    profiles = [item.strip() for item in args.profiles.split(",") if item.strip()]
+    unknown = [item for item in profiles if item not in PROFILES]
+    if unknown or args.repeat <= 0:
+        print(f"[ERROR] 无效参数: profiles={unknown or profiles}, repeat={args.repeat}")
+        return 2
+    if not cli_path.is_file() or not bills_dir.is_dir():
+        print(f"[ERROR] 找不到 CLI 或记录目录: {cli_path}, {bills_dir}")
+        return 2
+
+    results: dict[str, dict] = {}
+    for profile in profiles:
+        try:
+            results[profile] = bench_profile(args, cli_path, bills_dir, profile)
+        except RuntimeError as error:
+            print(f"[ERROR] {profile}: {error}")
+            return 1
+
+    print(f"{'profile':<10} {'ingest median (s)':>18} {'query median (s)':>18}")
+    for profile, samples in results.items():
+        print(
+            f"{profile:<10} {statistics.median(samples['ingest']):>18.3f} "
+            f"{statistics.median(samples['query']):>18.3f}"
+        )
+    if args.json_out:
+        Path(args.json_out).write_text(
+            json.dumps(
+                {"bills": str(bills_dir), "repeat": args.repeat, "results": results},
+                ensure_ascii=False,
+                indent=2,
+            ),
+            encoding="utf-8",
+        )
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())